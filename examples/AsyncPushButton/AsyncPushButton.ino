@@ -15,7 +15,7 @@ using namespace corex;
 // [t:76ms ESP8822001] ******* Chip is (re)booting *******
 // [t:5319ms ESP8822001] Interrupt (ISR) : Button was pressed
 //
-// => this message appears instantly when the push button is pressed
+// => the press is recorded by the ISR and this message appears at the next loop of the ModuleSequencer
 // -----------------------------------------------------------------------------------------------------------------------
 
 #define PUSH_BUTTON_PIN	D1
@@ -31,6 +31,8 @@ void setup()
 	myAsyncPushButton.notifyPressedState += []() {
 		Logln (F("Interrupt (ISR) : Button was pressed"));
 	};
+
+	I(ModuleSequencer).setup ({});
 }
 
 //========================================================================================================================
@@ -38,4 +40,5 @@ void setup()
 //========================================================================================================================
 void loop()
 {
+	I(ModuleSequencer).loop ();
 }
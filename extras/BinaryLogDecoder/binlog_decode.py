@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+#************************************************************************************************************************
+# binlog_decode.py
+# Version 1.0 October, 2026
+# Author Gerald Guiony
+#************************************************************************************************************************
+#
+# Host decoder of the frames recorded by corex::BinaryLogger (src/Print/BinaryLogger.h)
+#
+# 1. Generate the string table from the sources of the firmware (every LogBin ("...") call) :
+#		binlog_decode.py table <src dir|file> [...] > strings.json
+#
+# 2. Decode a capture (file or serial device, "-" for stdin) :
+#		binlog_decode.py decode strings.json /dev/ttyUSB0
+#
+
+import json
+import re
+import struct
+import sys
+from pathlib import Path
+
+FRAME_MAGIC = 0xA5
+
+LOGBIN_RE = re.compile(r'LogBin\s*\(\s*"((?:[^"\\]|\\.)*)"')
+SOURCE_SUFFIXES = {'.h', '.hpp', '.c', '.cpp', '.ino'}
+
+C_ESCAPE_RE = re.compile(rb'\\(x[0-9a-fA-F]+|[0-7]{1,3}|.)', re.DOTALL)
+C_ESCAPES = {b'n': b'\n', b't': b'\t', b'r': b'\r', b'a': b'\a', b'b': b'\b', b'f': b'\f', b'v': b'\v', b'e': b'\x1b'}
+
+
+def message_id(raw):
+	"""FNV-1a 32 bits of the bytes of the literal, same as BinaryLogger::messageId"""
+	h = 2166136261
+	for b in raw:
+		h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+	return h
+
+
+def unescape(literal):
+	"""Bytes of a C string literal : only the C escapes are replaced, the other chars keep their utf-8 encoding"""
+	def replace(m):
+		esc = m.group(1)
+		if esc[0:1] == b'x':
+			return bytes([int(esc[1:], 16) & 0xFF])
+		if esc[0] in b'01234567':
+			return bytes([int(esc, 8) & 0xFF])
+		return C_ESCAPES.get(esc, esc)
+	return C_ESCAPE_RE.sub(replace, literal.encode('utf-8'))
+
+
+def build_table(dirs):
+	table = {}
+	for d in dirs:
+		paths = [Path(d)] if Path(d).is_file() else Path(d).rglob('*')
+		for path in paths:
+			if path.suffix not in SOURCE_SUFFIXES or not path.is_file():
+				continue
+			for m in LOGBIN_RE.finditer(path.read_text(encoding='utf-8', errors='ignore')):
+				raw = unescape(m.group(1))
+				fmt = raw.decode('utf-8', errors='replace')
+				mid = '%08x' % message_id(raw)
+				if mid in table and table[mid] != fmt:
+					sys.stderr.write('WARNING: id collision %s: "%s" / "%s"\n' % (mid, table[mid], fmt))
+				table[mid] = fmt
+	return table
+
+
+# Size of the value of each type of argument (BINARY_LOG_TYPE_xxx)
+VALUE_SIZES = {ord('i'): 4, ord('u'): 4, ord('f'): 4, ord('c'): 4, ord('b'): 4, ord('I'): 8, ord('U'): 8, ord('d'): 8}
+
+
+def decode_value(kind, raw):
+	if kind == ord('I'):
+		return struct.unpack('<q', raw)[0]
+	if kind == ord('U'):
+		return struct.unpack('<Q', raw)[0]
+	if kind == ord('d'):
+		return '%.15g' % struct.unpack('<d', raw)[0]
+	if kind == ord('i'):
+		return struct.unpack('<i', raw)[0]
+	if kind == ord('f'):
+		return '%g' % struct.unpack('<f', raw)[0]
+	if kind == ord('c'):
+		return chr(raw[0])
+	if kind == ord('b'):
+		return 'true' if raw[0] else 'false'
+	return struct.unpack('<I', raw)[0]
+
+
+def format_message(fmt, values):
+	parts = fmt.split('{}')
+	out = parts[0]
+	for i, part in enumerate(parts[1:]):
+		out += (str(values[i]) if i < len(values) else '{?}') + part
+	return out
+
+
+def decode_args(payload):
+	"""Values of the arguments of a frame, None if they don't match exactly the payload"""
+	argc = payload[8]
+	values = []
+	off = 9
+	for a in range(argc):
+		if off >= len(payload) or payload[off] not in VALUE_SIZES:
+			return None
+		size = VALUE_SIZES[payload[off]]
+		if off + 1 + size > len(payload):
+			return None
+		values.append(decode_value(payload[off], payload[off + 1:off + 1 + size]))
+		off += 1 + size
+	return values if off == len(payload) else None
+
+
+def decode_frames(data, table):
+	"""Return the decoded lines and the number of bytes consumed (an incomplete frame at the end is not consumed),
+	resynchronize on the magic byte after a bad frame"""
+	lines = []
+	i = 0
+	while i + 2 <= len(data):
+		if data[i] != FRAME_MAGIC:
+			i += 1
+			continue
+		length = data[i + 1]
+		end = i + 2 + length
+		if end >= len(data):
+			break
+		payload = data[i + 2:end]
+		checksum = 0
+		for b in payload:
+			checksum ^= b
+		values = decode_args(payload) if length >= 9 and checksum == data[end] else None
+		if values is None:
+			i += 1
+			continue
+		mid, ms, argc = struct.unpack('<IIB', payload[:9])
+		fmt = table.get('%08x' % mid, '<unknown id %08x>' % mid + ' {}' * argc)
+		lines.append('[t:%dms] %s' % (ms, format_message(fmt, values)))
+		i = end + 1
+	return lines, i
+
+
+def main(argv):
+	if len(argv) >= 3 and argv[1] == 'table':
+		json.dump(build_table(argv[2:]), sys.stdout, indent=1, sort_keys=True)
+		sys.stdout.write('\n')
+		return 0
+
+	if len(argv) == 4 and argv[1] == 'decode':
+		table = json.loads(Path(argv[2]).read_text())
+		stream = sys.stdin.buffer if argv[3] == '-' else open(argv[3], 'rb')
+		pending = b''
+		while True:
+			chunk = stream.read1(4096) if hasattr(stream, 'read1') else stream.read(4096)
+			if not chunk:
+				break
+			pending += chunk
+			lines, consumed = decode_frames(pending, table)
+			pending = pending[consumed:]						# Keep the last incomplete frame for the next chunk
+			for line in lines:
+				print(line, flush=True)
+		return 0
+
+	sys.stderr.write(__doc__ or '')
+	sys.stderr.write('usage: binlog_decode.py table <src dir>... | decode <table.json> <capture|->\n')
+	return 1
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
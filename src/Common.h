@@ -12,14 +12,34 @@
 #include "EspBoardDefs.h"
 
 #include "Print/Logger.h"
+#include "Print/LogTag.h"
+#include "Print/BinaryLogger.h"
+#include "Print/RetainedLog.h"
+#include "Print/LogDispatcher.h"
+#include "Print/UartLogSink.h"
+#include "Print/IsrLog.h"
 #include "Storage/FileStorage.h"
+#include "Storage/FileLogSink.h"
 #include "Module/ModuleSequencer.h"
 
 #include "Stream/MemStream.h"
+#include "Stream/CborWriter.h"
 #include "Stream/StreamCmdParser.h"
+#include "Stream/CmdParamView.h"
+#include "Stream/CmdCorrelator.h"
+#include "Stream/CmdFrameDecoder.h"
+#include "Stream/CmdFrameParser.h"
+#include "Stream/CmdBinaryParser.h"
+#include "Stream/CommandRouter.h"
 
 #include "Tools/CriticalSection.h"
 #include "Tools/Signal.h"
+#include "Tools/StaticSignal.h"
+#include "Tools/DeferredSignal.h"
+#include "Tools/StaticWiring.h"
+#include "Tools/CoalescingSignal.h"
+#include "Tools/Profiler.h"
+#include "Tools/TopList.h"
 #include "Tools/Singleton.h"
 
 #include "WiFi/WiFiHelper.h"
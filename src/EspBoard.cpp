@@ -17,8 +17,12 @@
 
 #include "EspBoardDefs.h"
 #include "Print/Logger.h"
+#include "Print/Format.h"
+#include "Print/UartLogSink.h"
+#include "Module/ModuleSequencer.h"
 #include "Tools/Signal.h"
 #include "Storage/FileStorage.h"
+#include "Stream/CborWriter.h"
 #include "WiFi/WiFiHelper.h"
 
 #include "EspBoard.h"
@@ -45,6 +49,10 @@
 
 namespace corex {
 
+
+Signal <> EspBoard::notifyBeforeShutdown;
+
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -64,7 +72,7 @@ void EspBoard :: init (bool enableDebugSerial /*= false */) {
 
 		// if you wants serial echo - only recommended if ESP8266 is plugged in USB
 	//	I(Logger).notifyRequestLineToPrint += std::bind (&HardwareSerial::print, &Serial, std::placeholders::_1);
-		I(Logger).notifyRequestLineToPrint += [] (const String & line) { Serial.print (line); };
+		enableAsyncSerialLog (false);					// Synchronous by default (see enableAsyncSerialLog)
 
 	}
 
@@ -82,17 +90,54 @@ void EspBoard :: init (bool enableDebugSerial /*= false */) {
 	pinMode (BLINKLED, OUTPUT);							// Set led pin as output
 #endif
 
-	Logln (F("\n\n******* Chip is (re)booting *******"));
+	LogI (F("\n\n******* Chip is (re)booting *******"));
 
 	FileStorage::init ();								// Init file system
 }
 
 
+static UartLogSink * serialLogSink = nullptr;			// Only when the async log is used
+
+//========================================================================================================================
+// Sink of the logs on the Serial
+//========================================================================================================================
+UartLogSink * EspBoard :: getSerialLogSink () {
+	return serialLogSink;
+}
+
+//========================================================================================================================
+// Only one sink of the logs on the Serial (a second call replaces the previous one)
+//========================================================================================================================
+void EspBoard :: enableAsyncSerialLog (bool enable) {
+
+	static FunctionId serialId = 0;
+
+	I(Logger).notifyRequestLineToPrint -= serialId;
+	serialId = 0;
+	if (serialLogSink) {
+		serialLogSink->detach ();
+		I(ModuleSequencer).removeDeferred (serialLogSink);
+	}
+
+	if (enable) {
+		if (!serialLogSink) serialLogSink = new StaticUartLogSink <> (Serial);
+		serialLogSink->attach (I(Logger));				// Never blocks the caller, drained at each loop of the sequencer
+		I(ModuleSequencer).addDeferred (serialLogSink);
+	}
+	else {
+		if (serialLogSink) serialLogSink->flush ();
+		serialId = I(Logger).notifyRequestLineToPrint.push_back ("Serial", [] (const String & line) { Serial.print (line); });
+	}
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
 void EspBoard :: reboot () {
 
+	notifyBeforeShutdown ();
+	if (serialLogSink) serialLogSink->flush ();
+
 #ifdef ARDUINO_ESP8266_NODEMCU_ESP12E
 	pinMode (D0, OUTPUT);								// Nécessaire quand GPIO16 est relié au RST pin (DeepSleep)
 	digitalWrite (D0, LOW);
@@ -112,6 +157,18 @@ const String EspBoard :: getDeviceMemoryStats () {
 	return mem;
 }
 
+//========================================================================================================================
+// Status record in CBOR : { "id": uint, "heap": uint, "uptime": uint (ms), "deepSleepWakeUp": bool }
+//========================================================================================================================
+size_t EspBoard :: writeDeviceStatus (Print & printer) {
+
+	static const CborSchema <uint32_t, uint32_t, uint32_t, bool> status ("id", "heap", "uptime", "deepSleepWakeUp");
+
+	CborWriter cbor (printer);
+	status.write (cbor, getDeviceId (), ESP.getFreeHeap (), millis (), isWakeUpFromDeepSleep ());
+	return cbor.written ();
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -238,8 +295,14 @@ const String EspBoard :: getTimeElapsedSinceBoot () {
 	int runMinutes = secsRemaining / 60;
 	int runSeconds = secsRemaining % 60;
 
-	char buf [20];
-	sprintf (buf,"%02dh%02dm%02ds", runHours, runMinutes, runSeconds);
+	char buf [FMT_DEC_U32_LEN + 8];
+	size_t len = fmt::toDecPadded (buf, runHours, 2);
+	buf [len++] = 'h';
+	len += fmt::toDecPadded (buf + len, runMinutes, 2);
+	buf [len++] = 'm';
+	len += fmt::toDecPadded (buf + len, runSeconds, 2);
+	buf [len++] = 's';
+	buf [len] = 0;
 
 	return buf;
 }
@@ -269,7 +332,7 @@ void EspBoard :: blinkOn () {
 		digitalWrite(BLINKLED, LOW);					// Inverted logic !!
 	}
 #else
-	Log(F(".");
+	Log(F("."));
 #endif
 }
 
@@ -305,9 +368,11 @@ void EspBoard :: blinks (int nbBlink) {
 //========================================================================================================================
 void EspBoard :: enterDeepSleep (unsigned long long deepSleepTimeMs) {
 
-	Logln ("Enter in deep sleep mode..");
+	LogI ("Enter in deep sleep mode..");
 
 	WiFiHelper::disconnectAll ();
+	notifyBeforeShutdown ();
+	if (serialLogSink) serialLogSink->flush ();
 
 #ifdef ESP8266
 
@@ -471,12 +536,12 @@ void EspBoard :: enableSoftwareWatchdog (bool enable) {
 	// This will set the watchdog timeout to 30s and disable the controller reset if it’s triggered
 	esp_task_wdt_config_t wdt_config = {(uint32_t)(enable ? 5000 : 30000), enable};
 	if (esp_task_wdt_init(&wdt_config) == ESP_OK) {
-		Logln("Watchdog controller reset " << (enable ? "enabled" : "disabled") << " successfully !");
+		LogI("Watchdog controller reset " << (enable ? "enabled" : "disabled") << " successfully !");
 		// Add the current task to the Watchdog
 		esp_task_wdt_add(NULL); // NULL = tâche actuelle
 	}
 	else {
-		Logln("Error during Watchdog initialization!");
+		LogE("Error during Watchdog initialization!");
 	}
 #endif
 }
@@ -9,12 +9,16 @@
 #include <Stream.h>
 #include <StreamString.h>
 
+#include "Tools/Signal.h"
+
 #if !(defined (ESP8266) || defined (ESP32))
 #	error Platform not supported
 #endif
 
 namespace corex {
 
+class UartLogSink;
+
 //------------------------------------------------------------------------------
 // Static Class
 //------------------------------------------------------------------------------
@@ -30,6 +34,8 @@ public:
 
 	~EspBoard() = delete;	// you can not create an instance of such a class
 
+	static Signal <> notifyBeforeShutdown;										// Last chance to save something before a reboot or a deep sleep
+
 	static void init 								(bool enableDebugSerial = false);
 	static void reboot								();
 
@@ -38,6 +44,12 @@ public:
 	static const String getDeviceName				();
 	static const String getTimeElapsedSinceBoot		();
 	static const String getResetReason				(int cpuNo = 0);
+	static size_t writeDeviceStatus					(Print & printer);		// CBOR map, without String
+	static UartLogSink * getSerialLogSink			();						// nullptr until the async log is enabled
+	// Logs on the Serial through the TX ring of getSerialLogSink (never blocks the caller) instead of Serial.print.
+	// The sink (and its ring) is allocated by the first call with enable = true.
+	// WARNING : the ring is drained by ModuleSequencer::loop only, and the tail of the logs is lost by a crash or a reset
+	static void enableAsyncSerialLog				(bool enable = true);
 
 	static void setPortPower						(bool on);
 
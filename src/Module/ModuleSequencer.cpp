@@ -8,16 +8,19 @@
 
 #include "EspBoard.h"
 #include "Print/Logger.h"
+#include "Print/IsrLog.h"
 #include "BlinkerModule.h"
 #include "WiFi/WiFiHelper.h"
 
+#include "Tools/Profiler.h"
+
 #include "ModuleSequencer.h"
 
 
 namespace corex {
 
 
-SINGLETON_IMPL (ModuleSequencer)
+SINGLETON_STATIC_IMPL (ModuleSequencer, SINGLETON_INIT_PRIORITY_SEQUENCER)
 
 
 //========================================================================================================================
@@ -62,6 +65,7 @@ void ModuleSequencer :: setModules (const std::list <IModule *> & modules, bool
 void ModuleSequencer :: setup (const std::list <IModule *> & modules, bool addBlinkerModule)
 {
 	setModules (modules, addBlinkerModule);
+	I(IsrLog).attachToSequencer ();						// The logs of the ISRs are formatted in this loop
 	requestWakeUp ();
 }
 
@@ -76,11 +80,21 @@ void ModuleSequencer :: loop ()
 	// Explicitly restart the software watchdog
 	//ESP.wdtFeed ();
 
+	// Deliver in task context what was recorded since the last loop (ex: events posted by the ISRs)
+	for (IDeferred * deferred : _deferreds) {
+		deferred->drain ();
+	}
+	notifyAwake.drain ();
+	I(Logger).reportRepeats ();
+
 	if (_itModule != _modules.end ()) {
 
 		// The ESP8266 runs a lot of utility functions in the background – keeping WiFi connected, managing the TCP/IP stack, and performing other duties. Blocking these
 		// functions from running can cause the ESP8266 to crash and reset itself. To avoid these mysterious resets, avoid long, blocking loops in your sketch.
-		(*_itModule)->loop ();
+		{
+			CORE_PROFILE_SCOPE ("Module loop");
+			(*_itModule)->loop ();
+		}
 
 		_itModule++;
 
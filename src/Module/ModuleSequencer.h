@@ -15,6 +15,8 @@
 
 #include "Tools/Singleton.h"
 #include "Tools/Signal.h"
+#include "Tools/DeferredSignal.h"
+#include "Tools/CoalescingSignal.h"
 
 #include "Module.h"
 
@@ -37,7 +39,7 @@ namespace corex {
 //
 class ModuleSequencer : public Module <const std::list <IModule *> &, bool>
 {
-	SINGLETON_CLASS(ModuleSequencer)
+	SINGLETON_STATIC_CLASS(ModuleSequencer)
 
 private:
 	using fn_b = std::function <bool()>;
@@ -56,13 +58,15 @@ private:
 	std::list <IModule *> 						_modules;
 	std::list <IModule *> :: iterator 			_itModule;
 
+	std::list <IDeferred *>						_deferreds;					// Drained at each loop
+
 private:
 
 	void setModules 							(const std::list <IModule *> & modules, bool addBlinkerModule);
 
 public:
 
-	Signal <bool> notifyAwake;
+	CoalescingSignal <bool> notifyAwake;						// Delivered (once) at the next loop
 
 public:
 
@@ -73,6 +77,9 @@ public:
 	void setConditionToEnterDeepSleep			(fn_b isTimeToEnterDeepSleep)				{ _isTimeToEnterDeepSleep	= isTimeToEnterDeepSleep;	}
 	void enterDeepSleepWhenWifiOff				();
 
+	void addDeferred							(IDeferred * deferred)						{ _deferreds.push_back (deferred);						}
+	void removeDeferred							(IDeferred * deferred)						{ _deferreds.remove (deferred);							}
+
 	void setup									(const std::list <IModule *> & modules, bool addBlinkerModule = true) override;
 	void loop									() override;
 };
@@ -0,0 +1,114 @@
+//************************************************************************************************************************
+// BinaryLogger.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Arduino.h>
+
+#include "Module/ModuleSequencer.h"
+
+#include "BinaryLogger.h"
+
+
+namespace corex {
+
+
+SINGLETON_STATIC_IMPL (BinaryLogger, SINGLETON_INIT_PRIORITY_BINARY_LOGGER)
+
+
+//========================================================================================================================
+// Complete the frame (magic, length, checksum) and copy it in the ring, or drop it when there is not enough room
+//========================================================================================================================
+void BinaryLogger :: push (uint8_t * frame, size_t len)
+{
+	if (!_buffer || (_used + len > _size)) {
+		_dropped++;
+		return;
+	}
+
+	frame [0] = BINARY_LOG_FRAME_MAGIC;
+	frame [1] = len - 3;							// Payload only
+
+	uint8_t checksum = 0;
+	for (size_t i = 2; i < len - 1; i++) {
+		checksum ^= frame [i];
+	}
+	frame [len - 1] = checksum;
+
+	size_t first = _size - _head;
+	if (first > len) first = len;
+	memcpy (_buffer + _head, frame, first);
+	memcpy (_buffer, frame + first, len - first);
+
+	_head = (_head + len) % _size;
+	_used += len;
+}
+
+//========================================================================================================================
+// Send the frames to the output from the ModuleSequencer loop (to call in setup, the sequencer is constructed)
+//========================================================================================================================
+void BinaryLogger :: begin (Print & output, size_t size)
+{
+	if (!_buffer) {
+		_buffer = new uint8_t [size];
+		_size = size;
+	}
+	_output = &output;
+	if (_attached) return;
+	I(ModuleSequencer).addDeferred (this);
+	_attached = true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void BinaryLogger :: end ()
+{
+	if (_attached) I(ModuleSequencer).removeDeferred (this);
+	_attached = false;
+	_output = nullptr;
+
+	delete [] _buffer;
+	_buffer = nullptr;
+	_size = _head = _tail = _used = 0;
+}
+
+//========================================================================================================================
+// Send the recorded frames, as is
+//========================================================================================================================
+size_t BinaryLogger :: flushTo (Print & printer, size_t maxBytes)
+{
+	size_t sent = 0;
+
+	while ((_used > 0) && (sent < maxBytes)) {
+
+		size_t len = _size - _tail;
+		if (len > _used) len = _used;
+		if (len > maxBytes - sent) len = maxBytes - sent;
+
+		size_t written = printer.write (_buffer + _tail, len);
+		if (written == 0) break;
+
+		_tail = (_tail + written) % _size;
+		_used -= written;
+		sent += written;
+	}
+
+	return sent;
+}
+
+//========================================================================================================================
+// Send to the output what it can take without blocking
+//========================================================================================================================
+void BinaryLogger :: drain ()
+{
+	if (!_output) return;
+
+	int room = _output->availableForWrite ();
+	if (room > 0) {
+		flushTo (*_output, room);
+	}
+}
+
+}
@@ -0,0 +1,149 @@
+//************************************************************************************************************************
+// BinaryLogger.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include <Print.h>
+
+#include <type_traits>
+
+#include "Tools/Singleton.h"
+#include "Tools/DeferredSignal.h"
+
+
+// Default size of the ring buffer of the encoded records (allocated by begin)
+#define BINARY_LOG_BUFFER_SIZE			512
+#define BINARY_LOG_MAX_ARGS				8
+
+#define BINARY_LOG_FRAME_MAGIC			0xA5
+
+// Types of the arguments (decoded by extras/BinaryLogDecoder/binlog_decode.py)
+#define BINARY_LOG_TYPE_INT				'i'
+#define BINARY_LOG_TYPE_UINT			'u'
+#define BINARY_LOG_TYPE_FLOAT			'f'
+#define BINARY_LOG_TYPE_CHAR			'c'
+#define BINARY_LOG_TYPE_BOOL			'b'
+#define BINARY_LOG_TYPE_INT64			'I'						// 8 bytes values
+#define BINARY_LOG_TYPE_UINT64			'U'
+#define BINARY_LOG_TYPE_DOUBLE			'd'
+
+
+//------------------------------------------------------------------------------
+// Deferred binary log : the format string is never stored nor formatted on the chip, only its id (hash computed at
+// compile time) and the raw values of the arguments are recorded. Each "{}" of the format is replaced by the next
+// argument by the host decoder.
+//
+// LogBin is a macro family of its own : Log/Logln keep their text output (console, sinks, command parser), only the
+// hot paths worth the saving are moved to LogBin.
+//
+// Example :
+//		I(BinaryLogger).begin (Serial1);			// Frames sent by the ModuleSequencer loop, decoded on the host
+//		LogBin ("Free heap {} bytes, rssi {}", ESP.getFreeHeap (), WiFi.RSSI ());
+//
+#define LogBin(fmt, ...)	I(corex::BinaryLogger).record (std::integral_constant <uint32_t, corex::BinaryLogger::messageId (fmt)>::value, ##__VA_ARGS__)
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// WARNING : SINGLETON !!!!
+// Nothing is allocated until begin () : the records logged before (or after end ()) are dropped and counted.
+//
+// Frame : [magic][len][id:4][time ms:4][argc:1][type:1 value:4 or 8]...[checksum xor] (little endian)
+class BinaryLogger : public IDeferred
+{
+	SINGLETON_STATIC_CLASS(BinaryLogger)
+
+private:
+
+	uint8_t *		_buffer				= nullptr;		// Allocated by begin ()
+	size_t			_size				= 0;
+	size_t			_head				= 0;			// Next byte to write
+	size_t			_tail				= 0;			// Next byte to send
+	size_t			_used				= 0;
+
+	uint32_t		_dropped			= 0;			// Records lost because the buffer was full
+
+	Print *			_output				= nullptr;		// Written by drain ()
+	bool			_attached			= false;		// drain () called by the ModuleSequencer loop
+
+	static inline uint8_t * encodeU32	(uint8_t * p, uint32_t v)	{	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+																		return p + 4;											}
+	static inline uint8_t * encodeU64	(uint8_t * p, uint64_t v)	{	return encodeU32 (encodeU32 (p, (uint32_t) v), (uint32_t) (v >> 32));	}
+
+	// Type and value of an argument
+	template <typename T>
+	static constexpr size_t argSize		()							{	return ((std::is_arithmetic <T>::value && !std::is_same <T, bool>::value &&
+																				(sizeof (T) > 4)) ? 9 : 5);								}
+
+	template <typename T>
+	static inline uint8_t * encodeArg	(uint8_t * p, T v)			{	if constexpr (std::is_same <T, bool>::value) {
+																			*p = BINARY_LOG_TYPE_BOOL;	return encodeU32 (p + 1, v ? 1 : 0);
+																		}
+																		else if constexpr (std::is_same <T, char>::value) {
+																			*p = BINARY_LOG_TYPE_CHAR;	return encodeU32 (p + 1, (uint8_t) v);
+																		}
+																		else if constexpr (std::is_floating_point <T>::value && (sizeof (T) > 4)) {
+																			double d = v; uint64_t u; memcpy (&u, &d, sizeof (u));
+																			*p = BINARY_LOG_TYPE_DOUBLE; return encodeU64 (p + 1, u);
+																		}
+																		else if constexpr (std::is_floating_point <T>::value) {
+																			float f = v; uint32_t u; memcpy (&u, &f, sizeof (u));
+																			*p = BINARY_LOG_TYPE_FLOAT;	return encodeU32 (p + 1, u);
+																		}
+																		else if constexpr (std::is_enum <T>::value) {
+																			static_assert (sizeof (T) <= 4, "64 bits enums are not supported");
+																			*p = BINARY_LOG_TYPE_UINT;	return encodeU32 (p + 1, (uint32_t) v);
+																		}
+																		else if constexpr (std::is_signed <T>::value && (sizeof (T) > 4)) {
+																			*p = BINARY_LOG_TYPE_INT64;	return encodeU64 (p + 1, (uint64_t) (int64_t) v);
+																		}
+																		else if constexpr (std::is_signed <T>::value) {
+																			*p = BINARY_LOG_TYPE_INT;	return encodeU32 (p + 1, (uint32_t) (int32_t) v);
+																		}
+																		else if constexpr (sizeof (T) > 4) {
+																			static_assert (std::is_unsigned <T>::value, "Only the arithmetic values can be logged in binary");
+																			*p = BINARY_LOG_TYPE_UINT64; return encodeU64 (p + 1, (uint64_t) v);
+																		}
+																		else {
+																			static_assert (std::is_unsigned <T>::value, "Only the arithmetic values can be logged in binary");
+																			*p = BINARY_LOG_TYPE_UINT;	return encodeU32 (p + 1, (uint32_t) v);
+																		}														}
+
+	void push							(uint8_t * frame, size_t len);
+
+public:
+
+	// FNV-1a 32 bits, the same hash is computed by the host decoder
+	static constexpr uint32_t messageId	(const char * fmt, uint32_t hash = 2166136261u)
+																	{	return (*fmt == 0) ? hash : messageId (fmt + 1, (hash ^ (uint8_t) *fmt) * 16777619u);	}
+
+	template <typename ...T>
+	void record							(uint32_t id, T ...args)	{	static_assert (sizeof... (T) <= BINARY_LOG_MAX_ARGS, "Too many arguments");
+																		uint8_t frame [2 + 9 + (argSize <T> () + ... + 0) + 1];
+																		uint8_t * p = frame + 2;
+																		p = encodeU32 (p, id);
+																		p = encodeU32 (p, millis ());
+																		*p++ = sizeof... (T);
+																		((p = encodeArg (p, args)), ...);
+																		push (frame, sizeof (frame));							}
+
+	void setOutput						(Print * output)			{	_output = output;										}
+
+	// Allocate the ring (first call) and send the frames to the output from the ModuleSequencer loop
+	void begin							(Print & output, size_t size = BINARY_LOG_BUFFER_SIZE);
+	// Free the ring (the pending frames are lost)
+	void end							();
+
+	size_t flushTo						(Print & printer, size_t maxBytes = BINARY_LOG_BUFFER_SIZE);
+	virtual void drain					() override;
+
+	size_t pending						() const					{	return _used;											}
+	uint32_t dropped					() const					{	return _dropped;										}
+};
+
+}
@@ -0,0 +1,117 @@
+//************************************************************************************************************************
+// Format.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Format.h"
+
+
+namespace corex {
+namespace fmt {
+
+const char HEX_DIGITS [] = "0123456789ABCDEF";
+
+// The 100 pairs of digits "00" to "99" => one division by 100 for 2 digits
+static const char DEC_PAIRS [] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+//========================================================================================================================
+// Write the digits from the end of the buffer, return the first digit
+//========================================================================================================================
+static inline char * writeDigitsBackward (char * end, uint32_t value)
+{
+	char * p = end;
+	while (value >= 100) {
+		uint32_t pair = (value % 100) << 1;
+		value /= 100;
+		*--p = DEC_PAIRS [pair + 1];
+		*--p = DEC_PAIRS [pair];
+	}
+	if (value >= 10) {
+		uint32_t pair = value << 1;
+		*--p = DEC_PAIRS [pair + 1];
+		*--p = DEC_PAIRS [pair];
+	}
+	else {
+		*--p = '0' + value;
+	}
+	return p;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t toDec (char * buf, uint32_t value)
+{
+	return toDecPadded (buf, value, 0);
+}
+
+//========================================================================================================================
+// The pad characters are inserted in left until the width (a greater number is not truncated)
+//========================================================================================================================
+size_t toDecPadded (char * buf, uint32_t value, uint8_t width, char pad)
+{
+	char tmp [FMT_DEC_U32_LEN];
+	char * end = tmp + FMT_DEC_U32_LEN;
+	char * first = writeDigitsBackward (end, value);
+	size_t digits = end - first;
+
+	size_t len = 0;
+	while (len + digits < width) {
+		buf [len++] = pad;
+	}
+	memcpy (buf + len, first, digits);
+	len += digits;
+	buf [len] = 0;
+	return len;
+}
+
+//========================================================================================================================
+// By parts of 9 digits (the low parts are padded with 0)
+//========================================================================================================================
+size_t toDec64 (char * buf, uint64_t value)
+{
+	if (value <= 0xFFFFFFFFu) return toDec (buf, (uint32_t) value);
+
+	size_t len = toDec64 (buf, value / 1000000000u);
+	return len + toDecPadded (buf + len, (uint32_t) (value % 1000000000u), 9);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t printDec (Print & printer, uint32_t value, uint8_t width, char pad)
+{
+	char tmp [FMT_DEC_U32_LEN];
+	char * end = tmp + FMT_DEC_U32_LEN;
+	char * first = writeDigitsBackward (end, value);
+	size_t digits = end - first;
+
+	size_t len = 0;
+	for (; len + digits < width; len++) {
+		printer.write ((uint8_t) pad);
+	}
+	return len + printer.write ((const uint8_t *) first, digits);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t printDec64 (Print & printer, uint64_t value)
+{
+	char buf [FMT_DEC_U64_LEN + 1];
+	return printer.write ((const uint8_t *) buf, toDec64 (buf, value));
+}
+
+}
+}
@@ -0,0 +1,66 @@
+//************************************************************************************************************************
+// Format.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+
+// Max length of a formatted uint32_t in decimal (without the null terminator)
+#define FMT_DEC_U32_LEN					10
+#define FMT_DEC_U64_LEN					20
+
+
+namespace corex {
+namespace fmt {
+
+//------------------------------------------------------------------------------
+// Formatting of numbers in a buffer given by the caller (no String, no floating point, no division by a variable)
+// The functions write a null terminated string and return its length.
+// The buffer must contain at least max (width, FMT_DEC_U32_LEN) + 1 chars for the decimal formats.
+//
+extern const char HEX_DIGITS [];
+
+size_t toDec				(char * buf, uint32_t value);
+size_t toDecPadded			(char * buf, uint32_t value, uint8_t width, char pad = '0');
+// 64 bits : the buffer must contain FMT_DEC_U64_LEN + 1 chars (at most two 64 bits divisions)
+size_t toDec64				(char * buf, uint64_t value);
+
+// Fixed number of hexadecimal digits (upper case), the buffer must contain hexLen + 1 chars
+template <typename IntType>
+inline size_t toHex			(char * buf, IntType w, size_t hexLen = sizeof (IntType) << 1)
+{
+	for (size_t i = 0, j = (hexLen - 1) * 4; i < hexLen; ++i, j -= 4) {
+		buf [i] = HEX_DIGITS [(w >> j) & 0x0F];
+	}
+	buf [hexLen] = 0;
+	return hexLen;
+}
+
+// Value of an hexadecimal digit (upper or lower case) or -1
+inline int8_t hexValue		(char c)
+{
+	if ((c >= '0') && (c <= '9')) return c - '0';
+	c |= 0x20;										// Lower case
+	if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+	return -1;
+}
+
+//------------------------------------------------------------------------------
+// Direct write in a Print
+size_t printDec				(Print & printer, uint32_t value, uint8_t width = 0, char pad = '0');
+size_t printDec64			(Print & printer, uint64_t value);
+
+template <typename IntType>
+inline size_t printHex		(Print & printer, IntType w, size_t hexLen = sizeof (IntType) << 1)
+{
+	char buf [(sizeof (IntType) << 1) + 1];
+	if (hexLen > (sizeof (IntType) << 1)) hexLen = sizeof (IntType) << 1;
+	return printer.write (buf, toHex (buf, w, hexLen));
+}
+
+}
+}
@@ -0,0 +1,68 @@
+//************************************************************************************************************************
+// IsrLog.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Module/ModuleSequencer.h"
+
+#include "IsrLog.h"
+
+
+namespace corex {
+
+
+SINGLETON_STATIC_INST (IsrLog, SINGLETON_INIT_PRIORITY_ISR_LOG)
+
+#ifdef ESP32
+portMUX_TYPE IsrLog :: _mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+
+//========================================================================================================================
+// Nothing allocated before setup ()
+//========================================================================================================================
+IsrLog :: IsrLog ()
+{
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+IsrLog :: ~IsrLog ()
+{
+	if (_attached) I(ModuleSequencer).removeDeferred (&_records);
+}
+
+//========================================================================================================================
+// Called when the sequencer exists (not from a static constructor)
+//========================================================================================================================
+void IsrLog :: attachToSequencer ()
+{
+	subscribe ();
+	if (_attached) return;
+	I(ModuleSequencer).addDeferred (&_records);
+	_attached = true;
+}
+
+//========================================================================================================================
+// The records are formatted in task context
+//========================================================================================================================
+void IsrLog :: subscribe ()
+{
+	if (_formatterId) return;
+	_formatterId = _records.push_back ("IsrLog", [] (const __FlashStringHelper * msg, uint32_t arg, uint32_t cycles) {
+		uint32_t us = (isrCycleCount () - cycles) / ESP.getCpuFreqMHz ();
+		Logln (F("[isr -") << us << F("us] ") << msg << F(" ") << arg);
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void IsrLog :: printStats (Print & printer)
+{
+	printer << F("Isr log : ") << dropped () << F(" dropped records, max post ") << maxPostCycles () << F(" cycles") << LN;
+}
+
+}
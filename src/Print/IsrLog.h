@@ -0,0 +1,84 @@
+//************************************************************************************************************************
+// IsrLog.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include <Print.h>
+
+#include "Tools/Singleton.h"
+#include "Tools/DeferredSignal.h"
+#include "Logger.h"
+
+
+#define ISR_LOG_DEPTH					16						// Records waiting for the next loop (power of 2)
+
+
+//------------------------------------------------------------------------------
+// Log from an interrupt : only a fixed size record (flash message, argument, cycle counter) is copied in a wait-free ring,
+// the line is formatted by the Logger later, in ModuleSequencer::loop
+//
+// Example (ISR) : ISR_LOG ("Button pin changed", digitalRead (_pin));
+//
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#	define ISR_LOG(msg, arg)		corex::IsrLog::post (F(msg), (uint32_t) (arg))
+#else
+#	define ISR_LOG(msg, arg)
+#endif
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// WARNING : SINGLETON !!!!
+// Trivial constructor (static singleton) : the formatter is subscribed and the records are drained by the ModuleSequencer
+// once it is set up (ModuleSequencer::setup calls attachToSequencer), or by an explicit call to drain () in the loop of a
+// sketch without sequencer.
+// All the ISRs share one ring : on ESP32 post is serialized by a spinlock (ISRs of the two cores), on ESP8266 the ISRs
+// of the sketch don't nest (single core, same interrupt level) => never call ISR_LOG from an NMI.
+class IsrLog
+{
+	SINGLETON_STATIC_CLASS(IsrLog)
+
+private:
+
+	DeferredSignal <ISR_LOG_DEPTH, const __FlashStringHelper *, uint32_t, uint32_t>	_records;
+	bool								_attached		= false;
+	FunctionId							_formatterId	= 0;
+
+#ifdef ESP32
+	static portMUX_TYPE					_mux;
+#endif
+
+	void subscribe						();
+
+public:
+
+	// ISR side : in IRAM, direct access to the static instance
+	static IRAM_ATTR bool post			(const __FlashStringHelper * msg, uint32_t arg)
+																	{
+#ifdef ESP32
+																		portENTER_CRITICAL_ISR (&_mux);
+																		bool posted = _instance._records.post (msg, arg, isrCycleCount ());
+																		portEXIT_CRITICAL_ISR (&_mux);
+																		return posted;
+#else
+																		return _instance._records.post (msg, arg, isrCycleCount ());
+#endif
+																	}
+
+	// Task side
+	void attachToSequencer				();
+	void drain							()							{	subscribe (); _records.drain ();						}
+
+	uint32_t dropped					() const					{	return _records.overflows ();							}
+	uint32_t maxPostCycles				() const					{	return _records.maxPostCycles ();						}
+
+	void printStats						(Print & printer);
+	void resetStats						()							{	_records.resetStats ();									}
+};
+
+}
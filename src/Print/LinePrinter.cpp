@@ -25,34 +25,72 @@ void LinePrinter :: flush () {
 	_lineToPrint = F("");
 }
 
+//========================================================================================================================
+// Send the line and empty the buffer
+//========================================================================================================================
+void LinePrinter :: printLine () {
+	notifyRequestLineToPrint (_lineToPrint);
+	flush ();
+}
+
+//========================================================================================================================
+// First '\r' or '\n' of the buffer (or null)
+//========================================================================================================================
+static inline const uint8_t * findLineBreak (const uint8_t * buffer, size_t size) {
+	const uint8_t * ln = (const uint8_t *) memchr (buffer, _ln, size);
+	const uint8_t * cr = (const uint8_t *) memchr (buffer, _cr, ln ? (size_t) (ln - buffer) : size);
+	return cr ? cr : ln;
+}
+
 //========================================================================================================================
 // Print
 //========================================================================================================================
 size_t LinePrinter :: write (uint8_t character) {
+	return write (&character, 1);
+}
 
-	// Print ?
-	bool doPrint = false;
+//========================================================================================================================
+// Print : the runs of characters between the line breaks are copied at once
+//========================================================================================================================
+size_t LinePrinter :: write (const uint8_t * buffer, size_t size) {
 
-	// New line ?
-	if ((character == _ln) || (character == _cr)) {
-		character = _ln;
-		doPrint = true;
-	}
+	const size_t maxLen = BUFFER_PRINT_LEN - 2;				// Limit of buffer (we need at least 2 bytes for LN)
+	size_t remaining = size;
 
-	// Write to Buffer
-	_lineToPrint.concat ((char)character);
+	while (remaining > 0) {
 
-	if (_lineToPrint.length() >= BUFFER_PRINT_LEN - 2) {	// Limit of buffer (we need at least 2 bytes for LN)
-		doPrint = true;
-	}
+		// Start a new line
+		if (_lineToPrint.isEmpty ()) {
+			beginLine ();
+		}
+
+		size_t len = _lineToPrint.length ();
+		size_t chunk = (len < maxLen) ? (maxLen - len) : 1;
+		if (chunk > remaining) chunk = remaining;
+
+		// New line ?
+		const uint8_t * lineBreak = findLineBreak (buffer, chunk);
+		if (lineBreak) {
+			size_t n = lineBreak - buffer;
+			_lineToPrint.concat ((const char *) buffer, n);
+			_lineToPrint.concat (_ln);
+			buffer += n + 1;
+			remaining -= n + 1;
+			printLine ();
+			continue;
+		}
+
+		// Write to Buffer
+		_lineToPrint.concat ((const char *) buffer, chunk);
+		buffer += chunk;
+		remaining -= chunk;
 
-	// Send the characters buffered by print.h
-	if (doPrint) {							// Print the buffer
-		notifyRequestLineToPrint (_lineToPrint);
-		flush ();
+		if (_lineToPrint.length () >= maxLen) {
+			printLine ();
+		}
 	}
 
-	return 1;  // Don't break the print of the buffer !
+	return size;  // Don't break the print of the buffer !
 }
 
 }
\ No newline at end of file
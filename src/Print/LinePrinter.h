@@ -9,6 +9,7 @@
 #include <Print.h>
 
 #include "Tools/Signal.h"
+#include "Format.h"
 
 //------------------------------------------------------------------------------
 // Streaming template
@@ -34,6 +35,10 @@ protected:
 
 	String _lineToPrint 				= "";				// Buffer of print write to telnet
 
+	virtual void beginLine				() {}				// Called before the first character of each line
+
+	virtual void printLine				();				// Send the line and empty the buffer
+
 public:
 
 	Signal <const String &>				notifyRequestLineToPrint;
@@ -46,6 +51,8 @@ public:
 
 	// Print
 	virtual size_t write				(uint8_t) override;
+	virtual size_t write				(const uint8_t * buffer, size_t size) override;
+	using Print::write;
 };
 
 
@@ -55,12 +62,10 @@ public:
 //========================================================================================================================
 template <typename IntType>
 String n2hexstr (IntType w, size_t hex_len = sizeof(IntType)<<1) {
-	static const char* digits = "0123456789ABCDEF";
-	String rc;
-	rc.reserve (hex_len);
-	for (size_t i=0, j=(hex_len-1)*4 ; i<hex_len; ++i,j-=4)
-		rc += digits [ (w>>j) & 0x0F ];
-	return rc;
+	char buf [(sizeof(IntType)<<1) + 1];
+	if (hex_len > (sizeof(IntType)<<1)) hex_len = sizeof(IntType)<<1;
+	fmt::toHex (buf, w, hex_len);
+	return buf;										// Prefer fmt::toHex or fmt::printHex (no String)
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,319 @@
+//************************************************************************************************************************
+// LogDispatcher.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Arduino.h>
+
+#include "LogDispatcher.h"
+
+
+namespace corex {
+
+
+LogDispatcher * LogDispatcher :: _first = nullptr;
+
+
+//========================================================================================================================
+// Only needed with the ESP32 task (the queue is shared between 2 cores), the lines are never pushed from an ISR
+//========================================================================================================================
+inline void LogDispatcher :: lock () {
+#ifdef ESP32
+	portENTER_CRITICAL (&_mux);
+#endif
+}
+
+inline void LogDispatcher :: unlock () {
+#ifdef ESP32
+	portEXIT_CRITICAL (&_mux);
+#endif
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+LogDispatcher :: LogDispatcher (LogQueuePolicy policy, uint32_t blockTimeoutMs) :
+	_policy (policy), _blockTimeoutMs (blockTimeoutMs)
+{
+	_next = _first;
+	_first = this;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+LogDispatcher :: ~LogDispatcher ()
+{
+#ifdef ESP32
+	stopTask ();
+#endif
+	detach ();
+
+	for (LogDispatcher ** it = &_first; *it; it = &(*it)->_next) {
+		if (*it == this) { *it = _next; break; }
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+int LogDispatcher :: addSink (Print & printer, const char * name, bool withoutBlocking)
+{
+	int index = -1;
+
+	lock ();
+	for (uint8_t i = 0; i < LOG_DISPATCHER_MAX_SINKS; i++) {
+		if (_sinks [i].printer == nullptr) {
+			// A new sink starts with the next line
+			_sinks [i] = { &printer, name, withoutBlocking, _head, 0, 0, 0 };
+			_sinkCount++;
+			index = i;
+			break;
+		}
+	}
+	unlock ();
+
+	return index;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: removeSink (Print & printer)
+{
+	// The slot is only freed : a drain in progress on another sink keeps its index
+	lock ();
+	for (uint8_t i = 0; i < LOG_DISPATCHER_MAX_SINKS; i++) {
+		if (_sinks [i].printer == &printer) {
+			_sinks [i].printer = nullptr;
+			_sinkCount--;
+			break;
+		}
+	}
+	updateTail ();
+	unlock ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: attach (LinePrinter & source)
+{
+	detach ();
+	_source = &source;
+	_sourceId = source.notifyRequestLineToPrint.push_back ("LogDispatcher", [this] (const String & line) {
+		push (line.c_str (), line.length ());
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: detach ()
+{
+	if (_source) {
+		_source->notifyRequestLineToPrint -= _sourceId;
+		_source = nullptr;
+		_sourceId = 0;
+	}
+}
+
+//========================================================================================================================
+// The oldest line kept is the oldest line not yet printed by all the sinks (lock held)
+//========================================================================================================================
+void LogDispatcher :: updateTail ()
+{
+	uint32_t tail = _head;
+	for (const Sink & sink : _sinks) {
+		if (sink.printer && ((int32_t) (sink.cursor - tail) < 0)) tail = sink.cursor;
+	}
+	_tail = tail;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool LogDispatcher :: push (const char * line, size_t len)
+{
+	if (_sinkCount == 0) return false;
+
+	if ((_policy == LogQueuePolicy::Block) && (_head - _tail >= LOG_DISPATCHER_DEPTH)) {
+		unsigned long start = millis ();
+		while ((_head - _tail >= LOG_DISPATCHER_DEPTH) && (millis () - start < _blockTimeoutMs)) {
+#ifdef ESP32
+			if (_task) { delay (1); continue; }
+#endif
+			drain ();
+			yield ();
+		}
+	}
+
+	lock ();
+
+	if (_head - _tail >= LOG_DISPATCHER_DEPTH) {
+
+		if (_policy != LogQueuePolicy::DropOldest) {
+			// The new line is lost for all the sinks
+			for (Sink & sink : _sinks) {
+				if (sink.printer) sink.dropped++;
+			}
+			unlock ();
+			return false;
+		}
+
+		// The oldest line is lost for the sinks which have not yet printed it
+		for (Sink & sink : _sinks) {
+			if (sink.printer && (sink.cursor == _tail)) {
+				sink.cursor++;
+				sink.offset = 0;
+				sink.dropped++;
+			}
+		}
+		_tail++;
+	}
+
+	Line & slot = _lines [_head % LOG_DISPATCHER_DEPTH];
+	if (len > LOG_DISPATCHER_LINE_LEN) {
+		// Truncated line : marked at its end
+		static const char TRUNCATED [] = "...\n";
+		size_t keep = LOG_DISPATCHER_LINE_LEN - (sizeof (TRUNCATED) - 1);
+		memcpy (slot.text, line, keep);
+		memcpy (slot.text + keep, TRUNCATED, sizeof (TRUNCATED) - 1);
+		len = LOG_DISPATCHER_LINE_LEN;
+		_truncated++;
+	}
+	else {
+		memcpy (slot.text, line, len);
+	}
+	slot.len = len;
+	_head++;
+
+	unlock ();
+	return true;
+}
+
+//========================================================================================================================
+// Print the pending lines of the sink, return false when the sink can't take more for now
+//========================================================================================================================
+bool LogDispatcher :: drainSink (Sink & sink)
+{
+	char chunk [LOG_DISPATCHER_LINE_LEN];
+
+	while (true) {
+
+		size_t room = LOG_DISPATCHER_LINE_LEN;
+		if (sink.withoutBlocking) {
+			int available = sink.printer->availableForWrite ();
+			if (available <= 0) return false;
+			if ((size_t) available < room) room = available;
+		}
+
+		// Copy the rest of the line (it may be overwritten by a push during the print)
+		lock ();
+		Print * printer = sink.printer;
+		if ((printer == nullptr) || (sink.cursor == _head)) {
+			unlock ();
+			return true;
+		}
+		const Line & line = _lines [sink.cursor % LOG_DISPATCHER_DEPTH];
+		size_t len = line.len - sink.offset;
+		if (len > room) len = room;
+		memcpy (chunk, line.text + sink.offset, len);
+		uint32_t cursor = sink.cursor;
+		unlock ();
+
+		size_t written = printer->write ((const uint8_t *) chunk, len);
+
+		lock ();
+		if ((sink.printer == printer) && (sink.cursor == cursor)) {	// Not removed nor dropped in the meantime
+			sink.offset += written;
+			if (sink.offset >= _lines [cursor % LOG_DISPATCHER_DEPTH].len) {
+				sink.cursor++;
+				sink.offset = 0;
+				sink.printed++;
+			}
+		}
+		updateTail ();
+		unlock ();
+
+		if (written < len) return false;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: drain ()
+{
+#ifdef ESP32
+	// Only one drainer : the task when it is started
+	if (_task && (xTaskGetCurrentTaskHandle () != _task)) return;
+#endif
+	for (Sink & sink : _sinks) {
+		if (sink.printer) drainSink (sink);
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: printStats (Print & printer)
+{
+	printer << F("Log dispatcher : ") << (uint32_t) pending () << F(" pending lines, ") << _truncated << F(" truncated lines") << LN;
+	for (const Sink & sink : _sinks) {
+		if (!sink.printer) continue;
+		printer << F("- ") << (sink.name ? sink.name : "?")
+				<< F(" : printed ") << sink.printed
+				<< F(", dropped ") << sink.dropped << LN;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: printAllStats (Print & printer)
+{
+	for (LogDispatcher * dispatcher = _first; dispatcher; dispatcher = dispatcher->_next) {
+		dispatcher->printStats (printer);
+	}
+}
+
+#ifdef ESP32
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: taskLoop (void * dispatcher)
+{
+	LogDispatcher * self = (LogDispatcher *) dispatcher;
+	while (true) {
+		self->drain ();
+		vTaskDelay (pdMS_TO_TICKS (self->_taskPeriodMs));
+	}
+}
+
+//========================================================================================================================
+// The loop task of Arduino runs on the core 1 => the sinks are drained on the core 0 by default
+//========================================================================================================================
+bool LogDispatcher :: startTask (BaseType_t core, uint32_t periodMs, uint32_t stackSize)
+{
+	if (_task) return true;
+	_taskPeriodMs = periodMs ? periodMs : 1;
+	return xTaskCreatePinnedToCore (taskLoop, "LogDispatcher", stackSize, this, 1, &_task, core) == pdPASS;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogDispatcher :: stopTask ()
+{
+	if (_task) {
+		vTaskDelete (_task);
+		_task = nullptr;
+	}
+}
+
+#endif
+
+}
@@ -0,0 +1,130 @@
+//************************************************************************************************************************
+// LogDispatcher.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#ifdef ESP32
+#	include <freertos/FreeRTOS.h>
+#	include <freertos/task.h>
+#endif
+
+#include "Tools/Signal.h"
+#include "Tools/DeferredSignal.h"
+#include "LinePrinter.h"
+
+
+#define LOG_DISPATCHER_DEPTH			16						// Number of lines in the queue
+#define LOG_DISPATCHER_LINE_LEN			BUFFER_PRINT_LEN		// Longer lines are truncated (ended by "...\n")
+#define LOG_DISPATCHER_MAX_SINKS		4
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// What to do with a new line when the queue is full
+enum class LogQueuePolicy : uint8_t {
+	DropOldest,							// The oldest line is lost for the sinks which have not yet printed it
+	DropNewest,							// The new line is lost for all the sinks
+	Block								// Wait (drain) until a sink frees a line or the timeout, then drop the new line
+};
+
+//------------------------------------------------------------------------------
+// Asynchronous fan-out of the lines of a LinePrinter (ex: Logger) : the lines are copied in a fixed size queue, each sink
+// has its own cursor and prints them at its own rate in drain () (ModuleSequencer loop or ESP32 task).
+// A sink "without blocking" only writes what its availableForWrite () accepts (partial lines are continued later).
+// On ESP32, when the task is started it is the only one to drain (drain () called by the sequencer does nothing).
+// A removed sink keeps its slot free (the indexes of the other sinks do not change).
+// The statistics of all the dispatchers are printed by the debug console ('u').
+//
+// Example :
+//		LogDispatcher dispatcher;
+//		dispatcher.addSink (Serial, "Serial");
+//		dispatcher.attach (I(Logger));
+//		I(ModuleSequencer).addDeferred (&dispatcher);
+//
+class LogDispatcher : public IDeferred
+{
+private:
+
+	struct Line {
+		uint16_t		len;
+		char			text [LOG_DISPATCHER_LINE_LEN];
+	};
+
+	struct Sink {
+		Print *			printer;									// null => free slot
+		const char *	name;
+		bool			withoutBlocking;
+		uint32_t		cursor;										// Sequence number of the next line to print
+		size_t			offset;										// Chars of this line already printed
+		uint32_t		printed;
+		uint32_t		dropped;
+	};
+
+	Line				_lines [LOG_DISPATCHER_DEPTH];
+	uint32_t			_head				= 0;					// Sequence number of the next pushed line
+	uint32_t			_tail				= 0;					// Sequence number of the oldest kept line
+
+	Sink				_sinks [LOG_DISPATCHER_MAX_SINKS]	= {};
+	uint8_t				_sinkCount			= 0;					// Used slots
+	uint32_t			_truncated			= 0;
+
+	static LogDispatcher *	_first;								// All the dispatchers (statistics)
+	LogDispatcher *		_next				= nullptr;
+
+	LogQueuePolicy		_policy;
+	uint32_t			_blockTimeoutMs;
+
+	LinePrinter *		_source				= nullptr;
+	FunctionId			_sourceId			= 0;
+
+#ifdef ESP32
+	portMUX_TYPE		_mux				= portMUX_INITIALIZER_UNLOCKED;
+	TaskHandle_t		_task				= nullptr;
+	uint32_t			_taskPeriodMs		= 0;
+
+	static void taskLoop				(void * dispatcher);
+#endif
+
+	inline void lock					();
+	inline void unlock					();
+
+	void updateTail						();
+	bool drainSink						(Sink & sink);
+
+public:
+
+	LogDispatcher						(LogQueuePolicy policy = LogQueuePolicy::DropOldest, uint32_t blockTimeoutMs = 50);
+	~LogDispatcher						();
+
+	void setPolicy						(LogQueuePolicy policy, uint32_t blockTimeoutMs = 50)	{	_policy = policy; _blockTimeoutMs = blockTimeoutMs;	}
+
+	// Return the index of the sink, or -1 if there are too many sinks
+	int addSink							(Print & printer, const char * name = nullptr, bool withoutBlocking = true);
+	void removeSink						(Print & printer);
+
+	void attach							(LinePrinter & source);
+	void detach							();
+
+	bool push							(const char * line, size_t len);
+	virtual void drain					() override;
+
+	size_t pending						() const				{	return _head - _tail;									}
+	uint32_t dropped					(int sink) const		{	return _sinks [sink].dropped;							}
+	uint32_t printed					(int sink) const		{	return _sinks [sink].printed;							}
+	void printStats						(Print & printer);
+	static void printAllStats			(Print & printer);
+
+#ifdef ESP32
+	// Drain on a dedicated task pinned on a core (the other core than the loop task by default)
+	bool startTask						(BaseType_t core = 0, uint32_t periodMs = 10, uint32_t stackSize = 2048);
+	void stopTask						();
+#endif
+};
+
+}
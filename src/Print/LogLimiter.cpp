@@ -0,0 +1,82 @@
+//************************************************************************************************************************
+// LogLimiter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "LogLimiter.h"
+
+#ifdef LOG_RATE_LIMIT
+
+#include <Arduino.h>
+
+#include "Tools/TopList.h"
+#include "LinePrinter.h"
+
+
+namespace corex {
+
+
+LogSite * LogLimiter :: _head		= nullptr;
+uint32_t LogLimiter :: _suppressed	= 0;
+
+
+//========================================================================================================================
+// Constructed at the first log of the call site
+//========================================================================================================================
+LogSite :: LogSite (const char * file, uint16_t line) :
+	file (file), line (line), lastRefill (millis ())
+{
+	next = LogLimiter::_head;
+	LogLimiter::_head = this;
+}
+
+//========================================================================================================================
+// One token by line, the tokens are refilled at the rate of one by period (up to the burst)
+//========================================================================================================================
+bool LogSite :: allow ()
+{
+	uint32_t now = millis ();
+	uint32_t refill = (now - lastRefill) / LOG_RATE_LIMIT_PERIOD_MS;
+
+	if (refill > 0) {
+		tokens = (tokens + refill >= LOG_RATE_LIMIT_BURST) ? LOG_RATE_LIMIT_BURST : tokens + refill;
+		lastRefill += refill * LOG_RATE_LIMIT_PERIOD_MS;
+	}
+
+	if (tokens > 0) {
+		tokens--;
+		return true;
+	}
+
+	suppressed++;
+	LogLimiter::_suppressed++;
+	return false;
+}
+
+//========================================================================================================================
+// Print the call sites which have suppressed the most lines (no allocation : the list is scanned once per printed site)
+//========================================================================================================================
+void LogLimiter :: printStats (Print & printer, size_t count)
+{
+	printer << F("Suppressed log lines : ") << _suppressed << LN;
+
+	forEachTop (_head, count, [] (const LogSite * site) { return site->suppressed; }, [&] (const LogSite * top) {
+		printer << top->file << F(":") << top->line << F(" -> ") << top->suppressed << LN;
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void LogLimiter :: reset ()
+{
+	for (LogSite * site = _head; site; site = site->next) {
+		site->suppressed = 0;
+	}
+	_suppressed = 0;
+}
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+//************************************************************************************************************************
+// LogLimiter.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+// Define LOG_RATE_LIMIT (build flag) to limit the number of lines printed by each call site of the Log macros.
+// Without LOG_RATE_LIMIT nothing is compiled and the Log macros cost nothing more.
+
+#ifdef LOG_RATE_LIMIT
+
+#include <Print.h>
+
+
+#ifndef LOG_RATE_LIMIT_BURST
+#	define LOG_RATE_LIMIT_BURST			5						// Lines printed in a burst by one call site
+#endif
+#ifndef LOG_RATE_LIMIT_PERIOD_MS
+#	define LOG_RATE_LIMIT_PERIOD_MS		1000					// Then one line every period
+#endif
+
+#define LOG_LIMITER_TOP_COUNT			10
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Token bucket of one call site (a static variable of the Log macro => constant memory, no heap)
+struct LogSite
+{
+	const char *	file;
+	uint16_t		line;
+	uint8_t			tokens			= LOG_RATE_LIMIT_BURST;
+	uint32_t		lastRefill		= 0;
+	uint32_t		suppressed		= 0;
+
+	LogSite *		next			= nullptr;
+
+	LogSite			(const char * file, uint16_t line);
+
+	bool allow		();
+};
+
+//------------------------------------------------------------------------------
+// Static Class : list of all the call sites which have already logged
+//------------------------------------------------------------------------------
+class LogLimiter final
+{
+	friend struct LogSite;
+
+private:
+	static LogSite * _head;
+	static uint32_t _suppressed;
+
+public:
+
+	~LogLimiter() = delete;	// you can not create an instance of such a class
+
+	static uint32_t suppressed			()	{	return _suppressed;		}
+
+	static void printStats				(Print & printer, size_t count = LOG_LIMITER_TOP_COUNT);
+	static void reset					();
+};
+
+}
+
+// True if the line of this call site can be printed
+#define LOG_SITE_ALLOWED()	([] () -> bool { static corex::LogSite site (__FILE__, __LINE__); return site.allow (); } ())
+
+#endif
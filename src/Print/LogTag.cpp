@@ -0,0 +1,62 @@
+//************************************************************************************************************************
+// LogTag.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <string.h>
+
+#include "LogTag.h"
+
+
+namespace corex {
+
+
+LogTag * LogTags :: _head = nullptr;
+
+
+//========================================================================================================================
+// Constructed before setup () (static variable of a file)
+//========================================================================================================================
+LogTag :: LogTag (const char * name, uint8_t level) :
+	level (level), name (name)
+{
+	next = LogTags::_head;
+	LogTags::_head = this;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool LogTags :: setLevel (const char * name, uint8_t level)
+{
+	bool all = (strcmp (name, "*") == 0);
+	bool found = false;
+
+	for (LogTag * tag = _head; tag; tag = tag->next) {
+		if (all || (strcmp (tag->name, name) == 0)) {
+			tag->level = level;
+			found = true;
+		}
+	}
+	return found;
+}
+
+//========================================================================================================================
+// Each name once (the same tag can be declared in several files)
+//========================================================================================================================
+void LogTags :: printTags (Print & printer)
+{
+	printer << F("Log tags (level 0:none 1:error 2:warn 3:info 4:debug 5:trace, compiled up to ") << LOG_LEVEL << F(")") << LN;
+
+	for (const LogTag * tag = _head; tag; tag = tag->next) {
+
+		const LogTag * first = _head;
+		while (strcmp (first->name, tag->name) != 0) first = first->next;
+		if (first != tag) continue;
+
+		printer << F("- ") << tag->name << F(" : ") << tag->level << LN;
+	}
+}
+
+}
@@ -0,0 +1,91 @@
+//************************************************************************************************************************
+// LogTag.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#include "Logger.h"
+
+
+// Level of the tags at boot : all the compiled logs are shown (the logs of a greater level than LOG_LEVEL are not
+// compiled anyway), the console lowers it at runtime
+#ifndef LOG_TAG_DEFAULT_LEVEL
+#	define LOG_TAG_DEFAULT_LEVEL		LOG_LEVEL
+#endif
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Level of a subsystem, changed at runtime (debug console). A static variable declared by LOG_TAG in each .cpp file
+// => the check of a tagged log is one load and one compare (no lookup)
+struct LogTag
+{
+	volatile uint8_t	level;
+	const char *		name;
+
+	LogTag *			next			= nullptr;
+
+	LogTag				(const char * name, uint8_t level = LOG_TAG_DEFAULT_LEVEL);
+};
+
+//------------------------------------------------------------------------------
+// Static Class : list of all the tags (a tag used in several files is declared several times with the same name)
+//------------------------------------------------------------------------------
+class LogTags final
+{
+	friend struct LogTag;
+
+private:
+	static LogTag * _head;
+
+public:
+
+	~LogTags() = delete;	// you can not create an instance of such a class
+
+	// Return false if no tag has this name (name "*" => all the tags)
+	static bool setLevel				(const char * name, uint8_t level);
+	static void printTags				(Print & printer);
+};
+
+}
+
+// Tag of the logs of the current file (ex: LOG_TAG("wifi");)
+#define LOG_TAG(name)					static corex::LogTag _logTag (name)
+
+// Tagged logs (one line) : the arguments are not evaluated when the level of the tag is lower
+#define TLOG_(lvl, s)					do { if (_logTag.level >= (lvl)) LOG_LIMITED (LOGGER << s << LN); } while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#	define TLogE(s)						TLOG_ (LOG_LEVEL_ERROR, s)
+#else
+#	define TLogE(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#	define TLogW(s)						TLOG_ (LOG_LEVEL_WARN, s)
+#else
+#	define TLogW(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#	define TLogI(s)						TLOG_ (LOG_LEVEL_INFO, s)
+#else
+#	define TLogI(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#	define TLogD(s)						TLOG_ (LOG_LEVEL_DEBUG, s)
+#else
+#	define TLogD(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_TRACE
+#	define TLogT(s)						TLOG_ (LOG_LEVEL_TRACE, s)
+#else
+#	define TLogT(s)
+#endif
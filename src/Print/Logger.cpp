@@ -13,7 +13,7 @@
 namespace corex {
 
 
-SINGLETON_IMPL (Logger)
+SINGLETON_STATIC_IMPL (Logger, SINGLETON_INIT_PRIORITY_LOGGER)
 
 
 //========================================================================================================================
@@ -45,22 +45,60 @@ void Logger :: showChipName (bool show) {
 }
 
 //========================================================================================================================
-// Print
+// Collapse the repeated lines
 //========================================================================================================================
-size_t Logger :: write (uint8_t character) {
+void Logger :: collapseRepeats (bool collapse) {
+	if (_repeats) printRepeats ();
+	_collapseRepeats = collapse;
+	_lastLineHash = 0;
+	_lastLine = String ();
+}
+
+//========================================================================================================================
+// A burst of repetitions without a different line after it is reported here
+//========================================================================================================================
+void Logger :: reportRepeats (uint32_t delayMs) {
+	if (_repeats && (millis () - _repeatsStartMs >= delayMs)) printRepeats ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void Logger :: flush () {
+	if (_repeats) printRepeats ();
+	LinePrinter::flush ();
+}
+
+//========================================================================================================================
+// FNV-1a 32 bits
+//========================================================================================================================
+static inline uint32_t lineHash (const char * line, size_t len) {
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t) line [i]) * 16777619u;
+	}
+	return hash;
+}
+
+//========================================================================================================================
+// Header of the line (built once per line)
+//========================================================================================================================
+void Logger :: beginLine () {
 
 	static uint32_t lastTime = millis();
 	static uint32_t elapsed = 0;
 
 	// start a new line
-	if ((_lineToPrint.isEmpty())&&(_showTime||_showProfiler||_showChipName)) {
+	if (_showTime||_showProfiler||_showChipName) {
 
 		_lineToPrint = F("[");
 
+		char number [FMT_DEC_U32_LEN + 1];
+
 		// Show time in millis
 		if (_showTime) {
 			_lineToPrint.concat (F("t:"));
-			_lineToPrint.concat (millis());
+			_lineToPrint.concat (number, fmt::toDec (number, millis()));
 			_lineToPrint.concat (F("ms"));
 		}
 
@@ -96,7 +134,7 @@ size_t Logger :: write (uint8_t character) {
 			}
 
 			_lineToPrint.concat (F("p:"));
-			_lineToPrint.concat (formatNumber(elapsed, 4));
+			_lineToPrint.concat (number, fmt::toDecPadded (number, elapsed, 4));
 			_lineToPrint.concat (F("ms"));
 
 			if (resetColors) {
@@ -114,29 +152,53 @@ size_t Logger :: write (uint8_t character) {
 		_lineToPrint.concat (F("] "));
 	}
 
-	return LinePrinter :: write (character);
+	_headerLen = _lineToPrint.length ();
 }
 
 //========================================================================================================================
-// Format numbers
+// Print the number of times the last line has been repeated
 //========================================================================================================================
-String Logger::formatNumber(uint32_t value, uint8_t size, char insert) {
+void Logger :: printRepeats () {
 
-	// Putting zeroes in left
-	String ret = "";
+	char number [FMT_DEC_U32_LEN + 1];
 
-	for (uint8_t i=1; i<=size; i++) {
-		uint32_t max = pow(10, i);
-		if (value < max) {
-			for (uint8_t j=(size - i); j>0; j--) {
-				ret.concat(insert);
-			}
-			break;
+	String line;
+	line.reserve (40);
+	line = F("[last message repeated ");
+	line.concat (number, fmt::toDec (number, _repeats));
+	line.concat (F(" times]\n"));
+
+	_repeats = 0;
+	notifyRequestLineToPrint (line);
+}
+
+//========================================================================================================================
+// The same line (without header) is only counted, it is reported when a different line is printed
+//========================================================================================================================
+void Logger :: printLine () {
+
+	if (_collapseRepeats) {
+
+		const char * body = _lineToPrint.c_str () + _headerLen;
+		size_t bodyLen = _lineToPrint.length () - _headerLen;
+		uint32_t hash = lineHash (body, bodyLen);
+
+		// The hash only avoids most of the comparisons
+		if ((hash == _lastLineHash) && (bodyLen == _lastLine.length ()) && (memcmp (body, _lastLine.c_str (), bodyLen) == 0)) {
+			if (!_repeats) _repeatsStartMs = millis ();
+			_repeats++;
+			_collapsed++;
+			LinePrinter::flush ();
+			if (_repeats >= LOG_REPEAT_REPORT_MAX) printRepeats ();
+			return;
 		}
+
+		if (_repeats) printRepeats ();
+		_lastLineHash = hash;
+		_lastLine = body;
 	}
 
-	ret.concat(value);
-	return ret;
+	LinePrinter::printLine ();
 }
 
 }
\ No newline at end of file
@@ -8,9 +8,26 @@
 
 
 // The header file of the library might be able to see definitions from your sketch, the actual code (.c .cpp ) will not.
+// => the log level must be defined by a build flag (ex: -DLOG_LEVEL=LOG_LEVEL_WARN for a release build)
+
+//------------------------------------------------------------------------------
+// Log levels
+#define LOG_LEVEL_NONE					0
+#define LOG_LEVEL_ERROR					1
+#define LOG_LEVEL_WARN					2
+#define LOG_LEVEL_INFO					3
+#define LOG_LEVEL_DEBUG					4
+#define LOG_LEVEL_TRACE					5
+
+// Minimum level compiled, the logs of a greater level are removed (arguments not evaluated, no flash strings)
+#ifndef LOG_LEVEL
+#	define LOG_LEVEL					LOG_LEVEL_DEBUG
+#endif
 
 // Define DEBUG for lots of lovely debug output :)
-#define DEBUG
+#if LOG_LEVEL > LOG_LEVEL_NONE
+#	define DEBUG
+#endif
 
 #include "Tools/Singleton.h"
 #include "LinePrinter.h"
@@ -56,13 +73,60 @@
 #	else
 #		define LOGGER	Serial
 #	endif
-#	define Log(s)	(LOGGER << s)
-#	define Logln(s) (LOGGER << s << LN)
+#endif
+
+// Optional rate limit of each call site (see LogLimiter.h)
+#ifdef LOG_RATE_LIMIT
+#	include "LogLimiter.h"
+#	define LOG_LIMITED(...)	do { if (LOG_SITE_ALLOWED ()) (__VA_ARGS__); } while (0)
+#else
+#	define LOG_LIMITED(...)	(__VA_ARGS__)
+#endif
+
+// Log and Logln are debug logs
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#	define Log(s)	LOG_LIMITED (LOGGER << s)
+#	define Logln(s) LOG_LIMITED (LOGGER << s << LN)
 #else
 #	define Log(s)
 #	define Logln(s)
 #endif
 
+// Leveled logs (one line)
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#	define LogE(s)	LOG_LIMITED (LOGGER << s << LN)
+#else
+#	define LogE(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#	define LogW(s)	LOG_LIMITED (LOGGER << s << LN)
+#else
+#	define LogW(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#	define LogI(s)	LOG_LIMITED (LOGGER << s << LN)
+#else
+#	define LogI(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#	define LogD(s)	LOG_LIMITED (LOGGER << s << LN)
+#else
+#	define LogD(s)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_TRACE
+#	define LogT(s)	LOG_LIMITED (LOGGER << s << LN)
+#else
+#	define LogT(s)
+#endif
+
+// A repeated line is reported at the latest after this number of repetitions, or this delay (see reportRepeats)
+#define LOG_REPEAT_REPORT_MAX			1000
+#define LOG_REPEAT_REPORT_MS			1000
+
 
 namespace corex {
 
@@ -70,7 +134,7 @@ namespace corex {
 // WARNING : SINGLETON !!!!
 class Logger : public LinePrinter
 {
-	SINGLETON_CLASS(Logger)
+	SINGLETON_STATIC_CLASS(Logger)
 
 private:
 
@@ -78,8 +142,21 @@ private:
 	bool _showProfiler 					= false;			// Show time between messages
 	bool _showColors 					= false;			// Show colors
 	bool _showChipName					= false;			// Show the name of this Esp
+	bool _collapseRepeats				= false;			// Print "last message repeated N times" instead of the same line
+
+	size_t _headerLen					= 0;				// Length of the header of the current line
+	uint32_t _lastLineHash				= 0;				// Hash of the last printed line (without header)
+	String _lastLine;										// Last printed line (without header), compared when the hash matches
+	uint32_t _repeats					= 0;
+	uint32_t _repeatsStartMs			= 0;				// First repetition not yet reported
+	uint32_t _collapsed					= 0;				// Total of the collapsed lines
 
-	String formatNumber					(uint32_t value, uint8_t size, char insert='0');
+	void printRepeats					();
+
+protected:
+
+	virtual void beginLine				() override;
+	virtual void printLine				() override;
 
 public:
 
@@ -87,9 +164,14 @@ public:
 	void showProfiler					(bool show);
 	void showColors						(bool show);
 	void showChipName					(bool show);
+	void collapseRepeats				(bool collapse);
+	// Report the pending repetitions older than delayMs (called by ModuleSequencer::loop)
+	void reportRepeats					(uint32_t delayMs = LOG_REPEAT_REPORT_MS);
+
+	// Also reports the pending repetitions
+	virtual void flush					() override;
 
-	// Print
-	virtual size_t write				(uint8_t) override;
+	uint32_t collapsed					() const			{	return _collapsed;		}
 };
 
 
@@ -10,80 +10,269 @@
 #include "EspBoard.h"
 #include "Module/ModuleSequencer.h"
 
+#include "Tools/SignalProfiler.h"
+#include "Tools/Profiler.h"
+
 #include "Logger.h"
+#include "LogLimiter.h"
+#include "LogTag.h"
+#include "UartLogSink.h"
+#include "IsrLog.h"
+#include "LogDispatcher.h"
+#include "RetainedLog.h"
 #include "LoggerCommandParser.h"
 
 
-#define PRINT_HELP																											 \
-	F("-------------------------------------------------------------------------------------------------------")	<< LN << \
-	F(" *** AVAILABLE DEBUG COMMANDS *** ")																			<< LN << \
-	F("-------------------------------------------------------------------------------------------------------")	<< LN << \
-	F("? or h -> display these help of commands")																	<< LN << \
-	F("q -> quit (close current telnet session)")																	<< LN << \
-	F("m -> display memory available")																				<< LN << \
-	F("t -> show time (millis)")																					<< LN << \
-	F("p -> show time between actual and last message (in millis)")													<< LN << \
-	F("c -> show colors")																							<< LN << \
-	F("r -> reset the ESP8266")																						<< LN << \
-	F("-------------------------------------------------------------------------------------------------------")
+#define PRINT_HELP_LINE			F("-------------------------------------------------------------------------------------------------------")
 
 
 namespace corex {
 
+
+LoggerCommand LoggerCommands :: _commands [LOGGER_COMMANDS_MAX];
+uint8_t LoggerCommands :: _count = 0;
+uint8_t LoggerCommands :: _first [128] = { 0 };
+
+
+//========================================================================================================================
+// Compare a key of the RAM with a key of the flash
+//========================================================================================================================
+static bool isSameKey (const char * key, size_t len, const __FlashStringHelper * flashKey) {
+	PGM_P p = (PGM_P) flashKey;
+	for (size_t i = 0; i < len; i++) {
+		if (pgm_read_byte (p + i) != (uint8_t) key [i]) return false;
+	}
+	return pgm_read_byte (p + len) == 0;
+}
+
+//========================================================================================================================
+// "wifi 4" or "* 3"
+//========================================================================================================================
+static void setTagLevel (LoggerCommandParser &, char * args, Print & printer) {
+
+	char * name = strtok (args, " \t");
+	char * level = strtok (nullptr, " \t");
+
+	if (!name || !level || !isDigit (level [0]) || (level [0] - '0' > LOG_LEVEL_TRACE)) {
+		printer << F("usage : v <tag|*> <level>") << LN;
+		return;
+	}
+
+	if (LogTags::setLevel (name, level [0] - '0')) {
+		LogTags::printTags (printer);
+	}
+	else {
+		printer << F("[") << name << F("]: unknow tag") << LN;
+	}
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
-bool LoggerCommandParser :: parse (char byteRcv, Print & printer) {
+static void printLogStats (LoggerCommandParser &, char *, Print & printer) {
 
-	if (byteRcv == -1			||
-		isWhitespace (byteRcv)	||
-		isSpace (byteRcv)		||
-		!isAscii (byteRcv)		||
-		!isPrintable (byteRcv))	{
-		return false;
+	printer << F("Collapsed repeated log lines : ") << I(Logger).collapsed () << LN;
+	if (EspBoard::getSerialLogSink ()) EspBoard::getSerialLogSink ()->printStats (printer);
+	I(IsrLog).printStats (printer);
+	LogDispatcher::printAllStats (printer);
+#ifdef LOG_RATE_LIMIT
+	LogLimiter::printStats (printer);
+	LogLimiter::reset ();
+#endif
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static void reboot (LoggerCommandParser & parser, char *, Print & printer) {
+
+	printer << F("=> Reboot") << LN;
+	printer << F("Bye bye...") << LN;
+
+	parser.notifyCloseAllSessionResquested ();
+	I(ModuleSequencer).requestReboot ();
+}
+
+//========================================================================================================================
+// Commands of the library (added before the first command of the modules)
+//========================================================================================================================
+void LoggerCommands :: addBuiltins () {
+
+	static bool added = false;
+	if (added) return;
+	added = true;
+
+	add (F("?"), F("display these help of commands (or h)"),
+		[] (LoggerCommandParser &, char *, Print & printer) { printHelp (printer); });
+	add (F("h"), nullptr,
+		[] (LoggerCommandParser &, char *, Print & printer) { printHelp (printer); });
+	add (F("q"), F("quit (close current telnet session)"),
+		[] (LoggerCommandParser & parser, char *, Print &) { parser.notifyCloseCurrentSessionResquested (); });
+	add (F("m"), F("display memory available"),
+		[] (LoggerCommandParser &, char *, Print & printer) { printer << EspBoard::getDeviceMemoryStats (); });
+	add (F("t"), F("show time (millis)"),
+		[] (LoggerCommandParser &, char *, Print &) { I(Logger).showTime (true); });
+	add (F("p"), F("show time between actual and last message (in millis)"),
+		[] (LoggerCommandParser &, char *, Print &) { I(Logger).showProfiler (true); });
+	add (F("c"), F("show colors"),
+		[] (LoggerCommandParser &, char *, Print &) { I(Logger).showColors (true); });
+	add (F("l"), F("dump the log retained in RTC memory"),
+		[] (LoggerCommandParser &, char *, Print & printer) { I(RetainedLog).dump (printer); });
+	add (F("u"), F("show the collapsed, rate limited and dropped log lines"), printLogStats);
+	add (F("g"), F("list the log tags and their levels"),
+		[] (LoggerCommandParser &, char *, Print & printer) { LogTags::printTags (printer); });
+	add (F("v"), F("<tag|*> <level> : set the level of a log tag (0:none ... 5:trace)"), setTagLevel, true);
+	add (F("r"), F("reset the ESP8266"), reboot);
+
+#ifdef SIGNAL_PROFILING
+	add (F("s"), F("show the slowest slots of the signals (and reset the counters)"),
+		[] (LoggerCommandParser &, char *, Print & printer) { SignalProfiler::printTop (printer); SignalProfiler::reset (); });
+#endif
+#ifdef CORE_PROFILING
+	add (F("z"), F("show the profiled zones (and reset the counters)"),
+		[] (LoggerCommandParser &, char *, Print & printer) { Profiler::printZones (printer); Profiler::reset (); });
+#endif
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool LoggerCommands :: add (const __FlashStringHelper * key, const __FlashStringHelper * help, LoggerCommandHandler handler, bool withArgs) {
+
+	addBuiltins ();
+
+	uint8_t c = pgm_read_byte ((PGM_P) key);
+	if ((c == 0) || (c >= sizeof (_first)) || (_count >= LOGGER_COMMANDS_MAX)) return false;
+
+	// Already used ?
+	for (uint8_t i = _first [c]; i; i = _commands [i - 1].next) {
+		if (strcmp_P ((PGM_P) _commands [i - 1].key, (PGM_P) key) == 0) return false;
+	}
+
+	_commands [_count] = { key, help, handler, withArgs, _first [c] };
+	_first [c] = ++_count;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+const LoggerCommand * LoggerCommands :: find (const char * key, size_t len) {
+
+	addBuiltins ();
+
+	uint8_t c = (uint8_t) key [0];
+	if ((len == 0) || (c >= sizeof (_first))) return nullptr;
+
+	for (uint8_t i = _first [c]; i; i = _commands [i - 1].next) {
+		if (isSameKey (key, len, _commands [i - 1].key)) return &_commands [i - 1];
 	}
+	return nullptr;
+}
 
-	switch (byteRcv)
-	{
-	case '?':
-	case 'h':
-		printer << LN << PRINT_HELP << LN;
-		break;
+//========================================================================================================================
+// Command of one char without arguments, alone with this first char (otherwise the key is known at the end of the line)
+//========================================================================================================================
+const LoggerCommand * LoggerCommands :: findImmediate (char key) {
 
-	case 'q':
-		notifyCloseCurrentSessionResquested ();
-		break;
+	const LoggerCommand * command = find (&key, 1);
+	if (!command || command->withArgs) return nullptr;
+	return (_commands [_first [(uint8_t) key] - 1].next == 0) ? command : nullptr;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool LoggerCommands :: startsCommand (char key) {
 
-	case 'm':
-		printer << EspBoard::getDeviceMemoryStats ();
-		break;
+	addBuiltins ();
+	return ((uint8_t) key < sizeof (_first)) && _first [(uint8_t) key];
+}
 
-	case 't':
-		I(Logger).showTime(true);
-		break;
+//========================================================================================================================
+// In the order of the registration
+//========================================================================================================================
+void LoggerCommands :: printHelp (Print & printer) {
 
-	case 'p':
-		I(Logger).showProfiler(true);
-		break;
+	addBuiltins ();
 
-	case 'c':
-		I(Logger).showColors(true);
-		break;
+	printer << LN << PRINT_HELP_LINE << LN;
+	printer << F(" *** AVAILABLE DEBUG COMMANDS *** ") << LN;
+	printer << PRINT_HELP_LINE << LN;
+	for (uint8_t i = 0; i < _count; i++) {
+		if (!_commands [i].help) continue;
+		printer << _commands [i].key << F(" -> ") << _commands [i].help << LN;
+	}
+	printer << PRINT_HELP_LINE << LN;
+}
 
-	case 'r':
-		printer << F("=> Reboot") << LN;
-		printer << F("Bye bye...") << LN;
+//========================================================================================================================
+// "<key> <args>"
+//========================================================================================================================
+bool LoggerCommandParser :: execute (Print & printer) {
 
-		notifyCloseAllSessionResquested ();
-		I(ModuleSequencer).requestReboot ();
-		break;
+	_line [_lineLen] = 0;
 
-	default:
-		printer << F("[") << byteRcv << F("]: unknow command") << LN;
+	char * args = _line;
+	while (*args && !isSpace (*args)) args++;
+	size_t keyLen = args - _line;
+	while (*args && isSpace (*args)) args++;
+
+	const LoggerCommand * command = LoggerCommands::find (_line, keyLen);
+	if (!command) {
+		_line [keyLen] = 0;
+		printer << F("[") << _line << F("]: unknow command") << LN;
 		return false;
 	}
 
+	command->handler (*this, args, printer);
 	return true;
 }
 
+//========================================================================================================================
+//
+//========================================================================================================================
+bool LoggerCommandParser :: parse (char byteRcv, Print & printer) {
+
+	// Command with arguments : wait for the end of line
+	if (_inLine) {
+		if (byteRcv == _cr || byteRcv == _ln) {
+			_inLine = false;
+			return execute (printer);
+		}
+		if ((byteRcv == '\b') || (byteRcv == 0x7F)) {
+			if (_lineLen > 0) _lineLen--;
+		}
+		else if (isAscii (byteRcv) && isPrintable (byteRcv) && (_lineLen < LOGGER_COMMAND_LINE_LEN - 1)) {
+			_line [_lineLen++] = byteRcv;
+		}
+		return false;
+	}
+
+	if (byteRcv == -1			||
+		isWhitespace (byteRcv)	||
+		isSpace (byteRcv)		||
+		!isAscii (byteRcv)		||
+		!isPrintable (byteRcv))	{
+		return false;
+	}
+
+	const LoggerCommand * command = LoggerCommands::findImmediate (byteRcv);
+	if (command) {
+		char noArgs [1] = { 0 };
+		command->handler (*this, noArgs, printer);
+		return true;
+	}
+
+	if (LoggerCommands::startsCommand (byteRcv)) {
+		_line [0] = byteRcv;
+		_lineLen = 1;
+		_inLine = true;
+		return false;
+	}
+
+	printer << F("[") << byteRcv << F("]: unknow command") << LN;
+	return false;
+}
+
 }
@@ -10,12 +10,78 @@
 
 #include "Tools/Signal.h"
 
+
+#define LOGGER_COMMANDS_MAX					32						// Size of the table of the commands
+#define LOGGER_COMMAND_LINE_LEN				32						// Command with arguments (until the end of line)
+
+
 namespace corex {
 
+class LoggerCommandParser;
+
+// args : the rest of the line after the key (can be modified, ex: strtok), empty for the immediate commands
+using LoggerCommandHandler = void (*) (LoggerCommandParser & parser, char * args, Print & printer);
+
+//------------------------------------------------------------------------------
+// Entry of the table (the key and the help are flash strings)
+struct LoggerCommand
+{
+	const __FlashStringHelper *		key;
+	const __FlashStringHelper *		help;							// null => not listed in the help
+	LoggerCommandHandler			handler;
+	bool							withArgs;
+	uint8_t							next;							// Next command with the same first char (index + 1, 0 => end)
+};
+
+//------------------------------------------------------------------------------
+// Static Class : registry of the debug commands, shared by all the parsers
+// - a command of one char without arguments is executed as soon as the char is received, when no other command starts
+//   with this char
+// - the other ones (key of several chars, arguments or a shared first char) are executed at the end of the line :
+//   "<key> <args>" (ex: "m" then Enter when a "mqtt" command is added)
+// The dispatch is a lookup on the first char (128 entries) followed by the few commands with the same first char.
+//
+// Example (setup of a module) :
+//		LoggerCommands::add (F("ws"), F("show the wifi status"), [] (LoggerCommandParser &, char *, Print & printer) {
+//			printer << WiFi.status () << LN;
+//		});
+//
+//------------------------------------------------------------------------------
+class LoggerCommands final
+{
+private:
+	static LoggerCommand	_commands [LOGGER_COMMANDS_MAX];
+	static uint8_t			_count;
+	static uint8_t			_first [128];							// First char => index + 1 of the first command (0 => none)
+
+	static void addBuiltins				();
+
+public:
+
+	~LoggerCommands() = delete;	// you can not create an instance of such a class
+
+	// Return false if the table is full or the key already exists
+	static bool add						(const __FlashStringHelper * key, const __FlashStringHelper * help,
+										 LoggerCommandHandler handler, bool withArgs = false);
+
+	static const LoggerCommand * find	(const char * key, size_t len);
+	static const LoggerCommand * findImmediate	(char key);
+	static bool startsCommand			(char key);
+
+	static void printHelp				(Print & printer);
+};
+
 //------------------------------------------------------------------------------
 //
 class LoggerCommandParser
 {
+private:
+	char									_line [LOGGER_COMMAND_LINE_LEN];		// Command waiting for the end of line
+	uint8_t									_lineLen		= 0;
+	bool									_inLine			= false;
+
+	bool execute							(Print & printer);
+
 public:
 	Signal <>								notifyCloseCurrentSessionResquested;
 	Signal <>								notifyCloseAllSessionResquested;
@@ -26,4 +92,4 @@ public:
 	virtual bool parse						(char byteRcv, Print & printer);
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,248 @@
+//************************************************************************************************************************
+// RetainedLog.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Tools/Crc.h"
+
+#include "Logger.h"
+#include "RetainedLog.h"
+
+
+namespace corex {
+
+
+SINGLETON_IMPL (RetainedLog)
+
+
+//========================================================================================================================
+// Read in the data area (after the header), the ring wraps at the end of the memory
+//========================================================================================================================
+bool RetainedLog :: readData (size_t offset, void * data, size_t len)
+{
+	size_t first = _dataSize - offset;
+	if (first > len) first = len;
+	return _memory->read (sizeof (Header) + offset, data, first) &&
+		   ((first == len) || _memory->read (sizeof (Header), (uint8_t *) data + first, len - first));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RetainedLog :: writeData (size_t offset, const void * data, size_t len)
+{
+	size_t first = _dataSize - offset;
+	if (first > len) first = len;
+	return _memory->write (sizeof (Header) + offset, data, first) &&
+		   ((first == len) || _memory->write (sizeof (Header), (const uint8_t *) data + first, len - first));
+}
+
+//========================================================================================================================
+// Read and check the record at the offset, give the offset of the next one
+//========================================================================================================================
+bool RetainedLog :: readRecord (size_t offset, char * line, uint8_t & len, size_t & next)
+{
+	uint8_t prefix [3];
+	if (!readData (offset, prefix, sizeof (prefix))) return false;
+
+	len = prefix [0];
+	if ((len == 0) || (len + sizeof (prefix) > _dataSize)) return false;
+	if (!readData ((offset + sizeof (prefix)) % _dataSize, line, len)) return false;
+
+	uint16_t crc = prefix [1] | (prefix [2] << 8);
+	if (crc16 (line, len) != crc) return false;
+
+	next = (offset + sizeof (prefix) + len) % _dataSize;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t RetainedLog :: freeSpace () const
+{
+	if (_header.count == 0) return _dataSize;
+	return (_header.tail + _dataSize - _header.head) % _dataSize;
+}
+
+//========================================================================================================================
+// Return false if nothing was dropped
+//========================================================================================================================
+bool RetainedLog :: dropOldest ()
+{
+	uint8_t len = 0;
+	if (!_header.count || !readData (_header.tail, &len, 1)) return false;
+
+	_header.tail = (_header.tail + 3 + len) % _dataSize;
+	_header.count--;
+	if (_header.fresh > _header.count) _header.fresh = _header.count;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void RetainedLog :: saveHeader ()
+{
+	_header.magic = RETAINED_LOG_MAGIC;
+	_header.crc = crc16 (&_header, offsetof (Header, crc));
+	_memory->write (0, &_header, sizeof (Header));
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RetainedLog :: begin (RetainedMemory & memory)
+{
+	// Room for the header and at least one record of one char
+	if (memory.size () < sizeof (Header) + 4) {
+		LogE (F("RetainedLog : memory too small (") << memory.size () << F(" bytes)"));
+		_memory = nullptr;
+		_dataSize = 0;
+		return false;
+	}
+
+	_memory = &memory;
+	_dataSize = memory.size () - sizeof (Header);
+
+	bool valid = _memory->read (0, &_header, sizeof (Header)) &&
+				 (_header.magic == RETAINED_LOG_MAGIC) &&
+				 (_header.crc == crc16 (&_header, offsetof (Header, crc))) &&
+				 (_header.head < _dataSize) && (_header.tail < _dataSize) &&
+				 (_header.fresh <= _header.count);
+
+	if (valid) {
+		// Check all the records
+		char line [UINT8_MAX];
+		uint8_t len;
+		size_t offset = _header.tail;
+		for (uint16_t i = 0; valid && (i < _header.count); i++) {
+			valid = readRecord (offset, line, len, offset);
+		}
+		valid = valid && (offset == _header.head);
+	}
+
+	if (!valid) {
+		clear ();
+	}
+	return valid;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RetainedLog :: attachToLogger (RetainedMemory & memory)
+{
+	bool valid = begin (memory);
+	if (!_memory) return false;							// Memory too small
+
+	if (_header.fresh) {
+		I(Logger) << F("--- Retained log of the previous boot ---") << LN;
+		replay (I(Logger));
+		I(Logger) << F("---") << LN;
+	}
+
+	if (!_sinkId) {
+		_sinkId = I(Logger).notifyRequestLineToPrint.push_back ("RetainedLog", [this] (const String & line) {
+			append (line.c_str (), line.length ());
+		});
+	}
+	return valid;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void RetainedLog :: detachFromLogger ()
+{
+	I(Logger).notifyRequestLineToPrint -= _sinkId;
+	_sinkId = 0;
+}
+
+//========================================================================================================================
+// Append a line (truncated to 255 chars), the oldest lines are dropped to make room
+//========================================================================================================================
+void RetainedLog :: append (const char * line, size_t len)
+{
+	if (!_memory || (len == 0)) return;
+	if (len > UINT8_MAX) len = UINT8_MAX;
+	if (len + 3 > _dataSize) len = _dataSize - 3;
+
+	while (freeSpace () < len + 3) {
+		if (!dropOldest ()) {							// Unreadable memory : restart from an empty ring
+			clear ();
+			break;
+		}
+	}
+
+	uint16_t crc = crc16 (line, len);
+	uint8_t prefix [3] = { (uint8_t) len, (uint8_t) crc, (uint8_t) (crc >> 8) };
+
+	writeData (_header.head, prefix, sizeof (prefix));
+	writeData ((_header.head + sizeof (prefix)) % _dataSize, line, len);
+
+	_header.head = (_header.head + sizeof (prefix) + len) % _dataSize;
+	_header.count++;
+	_header.fresh++;
+	saveHeader ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void RetainedLog :: clear ()
+{
+	memset (&_header, 0, sizeof (Header));
+	if (_memory) saveHeader ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t RetainedLog :: replay (Print & printer)
+{
+	if (!_memory) return 0;
+
+	char line [UINT8_MAX];
+	uint8_t len;
+	size_t offset = _header.tail;
+	size_t printed = 0;
+	uint16_t fresh = _header.fresh;
+
+	// The replayed lines are marked before being printed : the printer may append new lines in the ring
+	_header.fresh = 0;
+	saveHeader ();
+
+	for (uint16_t i = 0; i < _header.count; i++) {
+		if (!readRecord (offset, line, len, offset)) break;
+		if (i + fresh < _header.count) continue;
+		printer.write ((const uint8_t *) line, len);
+		printed++;
+	}
+	return printed;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t RetainedLog :: dump (Print & printer)
+{
+	if (!_memory) return 0;
+
+	char line [UINT8_MAX];
+	uint8_t len;
+	size_t offset = _header.tail;
+	uint16_t count = _header.count;
+	size_t printed = 0;
+
+	printer << F("Retained log (") << count << F(" lines) :") << LN;
+	for (uint16_t i = 0; i < count; i++) {
+		if (!readRecord (offset, line, len, offset)) break;
+		printer.write ((const uint8_t *) line, len);
+		printed++;
+	}
+	return printed;
+}
+
+}
@@ -0,0 +1,74 @@
+//************************************************************************************************************************
+// RetainedLog.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#include "Tools/Singleton.h"
+#include "Tools/Signal.h"
+#include "Storage/RetainedMemory.h"
+
+
+#define RETAINED_LOG_MAGIC				0x524C4F47			// "RLOG"
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// WARNING : SINGLETON !!!!
+//
+// Logger sink which appends the lines in a ring kept in a retained memory (RTC memory), so the last lines survive a
+// deep sleep or a reboot. Each record is protected by a CRC, a corrupted ring is reset.
+//
+// Memory : [header][records...] with record = [len:1][crc16:2][line:len]
+class RetainedLog
+{
+	SINGLETON_CLASS(RetainedLog)
+
+private:
+
+	struct Header {
+		uint32_t	magic;
+		uint16_t	head;										// Offset of the next record (in the data area)
+		uint16_t	tail;										// Offset of the oldest record
+		uint16_t	count;										// Number of records
+		uint16_t	fresh;										// Number of newest records not yet replayed
+		uint16_t	crc;										// crc16 of the previous fields
+		uint16_t	reserved;
+	};
+
+	RetainedMemory *		_memory			= nullptr;
+	Header					_header;
+	size_t					_dataSize		= 0;
+	FunctionId				_sinkId			= 0;
+
+	bool readData					(size_t offset, void * data, size_t len);
+	bool writeData					(size_t offset, const void * data, size_t len);
+	bool readRecord					(size_t offset, char * line, uint8_t & len, size_t & next);
+	size_t freeSpace				() const;
+	bool dropOldest					();
+	void saveHeader					();
+
+public:
+
+	// Load the ring of the memory (reset it if it's not valid)
+	bool begin						(RetainedMemory & memory);
+	// begin + replay the lines of the previous boot in the Logger + append the next lines of the Logger
+	bool attachToLogger				(RetainedMemory & memory);
+	void detachFromLogger			();
+
+	void append						(const char * line, size_t len);
+	void clear						();
+
+	// Print the lines not yet replayed (and mark them as replayed) or all the lines
+	size_t replay					(Print & printer);
+	size_t dump						(Print & printer);
+
+	size_t count					() const						{	return _header.count;					}
+};
+
+}
@@ -0,0 +1,152 @@
+//************************************************************************************************************************
+// UartLogSink.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Arduino.h>
+
+#include "UartLogSink.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+// size must be a power of 2
+//========================================================================================================================
+UartLogSink :: UartLogSink (Print & uart, uint8_t * ring, size_t size) :
+	_uart (uart), _ring (ring), _mask (size - 1)
+{
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+UartLogSink :: ~UartLogSink ()
+{
+	detach ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void UartLogSink :: attach (LinePrinter & source)
+{
+	detach ();
+	_source = &source;
+	_sourceId = source.notifyRequestLineToPrint.push_back ("UartLogSink", [this] (const String & line) {
+		write ((const uint8_t *) line.c_str (), line.length ());
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void UartLogSink :: detach ()
+{
+	if (_source) {
+		_source->notifyRequestLineToPrint -= _sourceId;
+		_source = nullptr;
+		_sourceId = 0;
+	}
+}
+
+//========================================================================================================================
+// Send the contiguous parts of the ring while the UART has room
+//========================================================================================================================
+void UartLogSink :: send ()
+{
+	while (_head != _tail) {
+
+		int room = _uart.availableForWrite ();
+		if (room <= 0) return;
+
+		size_t offset = _tail & _mask;
+		size_t len = _head - _tail;
+		if (len > (_mask + 1) - offset) len = (_mask + 1) - offset;			// Until the end of the ring
+		if (len > (size_t) room) len = room;
+
+		size_t sent = _uart.write (_ring + offset, len);
+		_tail += sent;
+		if (sent < len) return;
+	}
+}
+
+//========================================================================================================================
+// Print : never waits for the UART
+//========================================================================================================================
+size_t UartLogSink :: write (const uint8_t * buffer, size_t size)
+{
+	unsigned long start = micros ();
+
+	send ();														// Keep the FIFO busy
+
+	if (size > (size_t) availableForWrite ()) {
+		_droppedBytes += size;
+		_droppedWrites++;
+	}
+	else {
+		size_t offset = _head & _mask;
+		size_t first = (_mask + 1) - offset;
+		if (first > size) first = size;
+
+		memcpy (_ring + offset, buffer, first);
+		memcpy (_ring, buffer + first, size - first);
+		_head += size;
+
+		if (pending () > _maxPending) _maxPending = pending ();
+		send ();
+	}
+
+	uint32_t us = micros () - start;
+	if (us > _maxWriteUs) _maxWriteUs = us;
+
+	return size;													// Don't break the print of the buffer !
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void UartLogSink :: flush ()
+{
+	uint32_t lastProgressMs = millis ();
+
+	while (_head != _tail) {
+		uint32_t tail = _tail;
+		send ();
+		if (_tail != tail) {
+			lastProgressMs = millis ();
+		}
+		else if (millis () - lastProgressMs >= UART_LOG_SINK_FLUSH_TIMEOUT_MS) {
+			_droppedBytes += pending ();
+			_droppedWrites++;
+			_tail = _head;
+			return;
+		}
+		yield ();
+	}
+	_uart.flush ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void UartLogSink :: printStats (Print & printer)
+{
+	printer << F("Uart log : ") << (uint32_t) pending () << F(" pending bytes (max ") << _maxPending
+			<< F("), dropped ") << _droppedBytes << F(" bytes in ") << _droppedWrites
+			<< F(" writes, max write ") << _maxWriteUs << F(" us") << LN;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void UartLogSink :: resetStats ()
+{
+	_droppedBytes	= 0;
+	_droppedWrites	= 0;
+	_maxPending		= pending ();
+	_maxWriteUs		= 0;
+}
+
+}
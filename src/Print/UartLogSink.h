@@ -0,0 +1,91 @@
+//************************************************************************************************************************
+// UartLogSink.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#include "Tools/Signal.h"
+#include "Tools/DeferredSignal.h"
+#include "LinePrinter.h"
+
+
+#define UART_LOG_SINK_RING_SIZE			1024					// Default TX ring (power of 2)
+#define UART_LOG_SINK_FLUSH_TIMEOUT_MS	100						// flush gives up when the UART takes nothing for this time
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Log sink which never blocks the caller : the bytes are copied in a TX ring and are sent to the UART only when its FIFO
+// (ESP8266) or its driver buffer (ESP32) has room (availableForWrite), at each write and in drain () (ModuleSequencer loop).
+// When the ring is full the whole write is dropped (no truncated line) and counted.
+// The ring is given by the caller (see StaticUartLogSink), the UART is any Print => it can be a stand-in on Linux.
+//
+class UartLogSink : public Print, public IDeferred
+{
+private:
+	Print &			_uart;
+	uint8_t *		_ring;
+	size_t			_mask;
+	uint32_t		_head					= 0;				// Total of the bytes written in the ring
+	uint32_t		_tail					= 0;				// Total of the bytes sent to the UART
+
+	// Statistics
+	uint32_t		_droppedBytes			= 0;
+	uint32_t		_droppedWrites			= 0;
+	uint32_t		_maxPending				= 0;
+	uint32_t		_maxWriteUs				= 0;				// Worst latency seen by the caller
+
+	LinePrinter *	_source					= nullptr;
+	FunctionId		_sourceId				= 0;
+
+	void send								();
+
+public:
+
+	UartLogSink								(Print & uart, uint8_t * ring, size_t size);
+	~UartLogSink							();
+
+	void attach								(LinePrinter & source);
+	void detach								();
+
+	// Print
+	virtual size_t write					(uint8_t character) override	{	return write (&character, 1);	}
+	virtual size_t write					(const uint8_t * buffer, size_t size) override;
+	using Print::write;
+	virtual int availableForWrite			() override						{	return (_mask + 1) - pending ();	}
+
+	// Send what the UART accepts now
+	virtual void drain						() override						{	send ();						}
+	// Blocking : wait until the ring is empty (before a reboot or a deep sleep), or until the UART stalls (not begun,
+	// TX blocked) during UART_LOG_SINK_FLUSH_TIMEOUT_MS : the rest is then dropped
+	virtual void flush						() override;
+
+	size_t pending							() const						{	return _head - _tail;			}
+	uint32_t droppedBytes					() const						{	return _droppedBytes;			}
+	uint32_t droppedWrites					() const						{	return _droppedWrites;			}
+	uint32_t maxWriteUs						() const						{	return _maxWriteUs;				}
+
+	void printStats							(Print & printer);
+	void resetStats							();
+};
+
+//------------------------------------------------------------------------------
+// UartLogSink with its own ring
+template <size_t N = UART_LOG_SINK_RING_SIZE>
+class StaticUartLogSink : public UartLogSink
+{
+	static_assert ((N >= 16) && ((N & (N - 1)) == 0), "The size of the ring must be a power of 2");
+
+private:
+	uint8_t			_storage [N];
+
+public:
+	StaticUartLogSink						(Print & uart) : UartLogSink (uart, _storage, N) {}
+};
+
+}
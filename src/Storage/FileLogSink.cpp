@@ -0,0 +1,266 @@
+//************************************************************************************************************************
+// FileLogSink.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Arduino.h>
+
+#include "EspBoard.h"
+#include "Module/ModuleSequencer.h"
+
+#include "FileLogSink.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+FileLogSink :: FileLogSink (fs::FS & fs, const char * prefix, uint8_t fileCount, size_t maxFileSize) :
+	_fs (fs), _prefix (prefix), _fileCount (fileCount ? fileCount : 1), _maxFileSize (maxFileSize)
+{
+	// Room for the index (3 digits max) and the suffix
+	if (strlen (_prefix) + 3 + strlen (FILE_LOG_SINK_SUFFIX) >= FILE_LOG_SINK_NAME_LEN) {
+		_prefix = FILE_LOG_SINK_PREFIX;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+FileLogSink :: ~FileLogSink ()
+{
+	detachFromSequencer ();
+	detach ();
+	flush ();
+}
+
+//========================================================================================================================
+// <prefix><index><suffix>
+//========================================================================================================================
+void FileLogSink :: fileName (char * name, uint8_t index) const
+{
+	snprintf (name, FILE_LOG_SINK_NAME_LEN, "%s%u%s", _prefix, (unsigned) index, FILE_LOG_SINK_SUFFIX);
+}
+
+//========================================================================================================================
+// Continue the current file
+//========================================================================================================================
+void FileLogSink :: begin ()
+{
+	char name [FILE_LOG_SINK_NAME_LEN];
+	fileName (name, 0);
+
+	_fileSize = 0;
+	if (_fs.exists (name)) {
+		File f = _fs.open (name, "r");
+		if (f) {
+			_fileSize = f.size ();
+			f.close ();
+		}
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: attach (LinePrinter & source)
+{
+	detach ();
+	_source = &source;
+	_sourceId = source.notifyRequestLineToPrint.push_back ("FileLogSink", [this] (const String & line) {
+		write ((const uint8_t *) line.c_str (), line.length ());
+	});
+	_shutdownId = EspBoard::notifyBeforeShutdown.push_back ("FileLogSink", [this] () {
+		flush ();
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: detach ()
+{
+	if (_source) {
+		_source->notifyRequestLineToPrint -= _sourceId;
+		_source = nullptr;
+		_sourceId = 0;
+		EspBoard::notifyBeforeShutdown -= _shutdownId;
+		_shutdownId = 0;
+	}
+}
+
+//========================================================================================================================
+// Write the partial block when the board goes idle (the reboot and the deep sleep are handled by attach)
+//========================================================================================================================
+void FileLogSink :: attachToSequencer ()
+{
+	detachFromSequencer ();
+	_awakeId = I(ModuleSequencer).notifyAwake.push_back ("FileLogSink", [this] (bool isAwake) {
+		if (!isAwake) flush ();
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: detachFromSequencer ()
+{
+	if (_awakeId) {
+		I(ModuleSequencer).notifyAwake -= _awakeId;
+		_awakeId = 0;
+	}
+}
+
+//========================================================================================================================
+// log<N-2> -> log<N-1> ... log0 -> log1, the oldest file is removed
+//========================================================================================================================
+void FileLogSink :: rotate ()
+{
+	char from [FILE_LOG_SINK_NAME_LEN];
+	char to [FILE_LOG_SINK_NAME_LEN];
+
+	fileName (to, _fileCount - 1);
+	if (_fs.exists (to)) _fs.remove (to);
+
+	for (int i = _fileCount - 2; i >= 0; i--) {
+		fileName (from, i);
+		if (_fs.exists (from)) _fs.rename (from, to);
+		memcpy (to, from, sizeof (to));
+	}
+
+	_fileSize = 0;
+	_rotations++;
+}
+
+//========================================================================================================================
+// Append the RAM block to the current file
+//========================================================================================================================
+void FileLogSink :: writeBlock ()
+{
+	if (_blockLen == 0) return;
+
+	unsigned long start = micros ();
+
+	// With one file, the rotation removes it
+	if (_fileSize + _blockLen > _maxFileSize) {
+		rotate ();
+	}
+
+	char name [FILE_LOG_SINK_NAME_LEN];
+	fileName (name, 0);
+
+	File f = _fs.open (name, "a");
+	if (f) {
+		size_t written = f.write (_block, _blockLen);
+		f.close ();
+		if (written != _blockLen) _failures++;
+		_fileSize += written;
+		_blocksWritten++;
+	}
+	else {
+		_failures++;
+	}
+
+	_blockLen = 0;
+
+	uint32_t us = micros () - start;
+	_flushes++;
+	_totalFlushUs += us;
+	if (us > _maxFlushUs) _maxFlushUs = us;
+}
+
+//========================================================================================================================
+// Print : the bytes are copied in the RAM block, the full blocks are written
+//========================================================================================================================
+size_t FileLogSink :: write (const uint8_t * buffer, size_t size)
+{
+	size_t remaining = size;
+
+	while (remaining > 0) {
+		size_t chunk = FILE_LOG_SINK_BLOCK_SIZE - _blockLen;
+		if (chunk > remaining) chunk = remaining;
+
+		memcpy (_block + _blockLen, buffer, chunk);
+		_blockLen += chunk;
+		buffer += chunk;
+		remaining -= chunk;
+
+		if (_blockLen == FILE_LOG_SINK_BLOCK_SIZE) {
+			writeBlock ();
+		}
+	}
+
+	_bytesLogged += size;
+	return size;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: flush ()
+{
+	writeBlock ();
+}
+
+//========================================================================================================================
+// From the oldest file to the RAM block
+//========================================================================================================================
+void FileLogSink :: printTo (Print & printer)
+{
+	char name [FILE_LOG_SINK_NAME_LEN];
+	uint8_t buffer [64];
+
+	for (int i = _fileCount - 1; i >= 0; i--) {
+		fileName (name, i);
+		if (!_fs.exists (name)) continue;
+
+		File f = _fs.open (name, "r");
+		if (!f) continue;
+		while (f.available ()) {
+			size_t len = f.read (buffer, sizeof (buffer));
+			if (len == 0) break;
+			printer.write (buffer, len);
+		}
+		f.close ();
+	}
+	printer.write (_block, _blockLen);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+float FileLogSink :: averageBlockFill () const
+{
+	size_t logged = _bytesLogged - _blockLen;								// The bytes of the RAM block are not yet written
+	return _blocksWritten ? (float) logged / ((float) _blocksWritten * FILE_LOG_SINK_BLOCK_SIZE) : 0.0f;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: printStats (Print & printer)
+{
+	printer << F("File log : ") << _bytesLogged << F(" bytes logged, ")
+			<< _blocksWritten << F(" blocks written, average block fill ") << averageBlockFill () << LN;
+	printer << F("Flushes : ") << _flushes << F(" (avg ") << (_flushes ? _totalFlushUs / _flushes : 0)
+			<< F(" us, max ") << _maxFlushUs << F(" us), rotations ") << _rotations
+			<< F(", failures ") << _failures << LN;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void FileLogSink :: resetStats ()
+{
+	_bytesLogged	= _blockLen;
+	_blocksWritten	= 0;
+	_flushes		= 0;
+	_rotations		= 0;
+	_failures		= 0;
+	_totalFlushUs	= 0;
+	_maxFlushUs		= 0;
+}
+
+}
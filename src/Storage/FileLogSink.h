@@ -0,0 +1,107 @@
+//************************************************************************************************************************
+// FileLogSink.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <FS.h>
+#include <LittleFS.h>
+
+#include <Print.h>
+
+#include "Tools/Signal.h"
+#include "Print/LinePrinter.h"
+
+
+#define FILE_LOG_SINK_BLOCK_SIZE				256						// RAM block = page of LittleFS (ESP8266 and ESP32)
+#define FILE_LOG_SINK_FILES						4						// Number of files of the rotation
+#define FILE_LOG_SINK_FILE_SIZE					16384					// Size cap of one file
+#define FILE_LOG_SINK_PREFIX					"/log"					// => /log0.txt (current) ... /log3.txt (oldest)
+#define FILE_LOG_SINK_SUFFIX					".txt"
+#define FILE_LOG_SINK_NAME_LEN					32						// Max length of a file name (null terminator included)
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Persistent log : the lines are batched in a RAM block of one flash page, the block is only appended to the file when it
+// is full, when the board goes idle (ModuleSequencer::notifyAwake (false)) or before a reboot or a deep sleep
+// (EspBoard::notifyBeforeShutdown).
+// When the current file reaches its size cap the files are rotated (the oldest one is removed, with only one file it is
+// restarted).
+// The file system is given to the constructor (LittleFS by default) => it can be a host image or a RAM stand-in to test.
+//
+// Example :
+//		FileStorage::init ();
+//		static FileLogSink fileLog;
+//		fileLog.begin ();
+//		fileLog.attach (I(Logger));
+//		fileLog.attachToSequencer ();
+//
+class FileLogSink : public Print
+{
+private:
+
+	fs::FS &		_fs;
+	const char *	_prefix;
+	uint8_t			_fileCount;
+	size_t			_maxFileSize;
+
+	uint8_t			_block [FILE_LOG_SINK_BLOCK_SIZE];
+	size_t			_blockLen				= 0;
+	size_t			_fileSize				= 0;					// Size of the current file
+
+	// Statistics
+	uint32_t		_bytesLogged			= 0;					// Bytes given to the sink
+	uint32_t		_blocksWritten			= 0;					// Blocks appended to the files (full or partial)
+	uint32_t		_flushes				= 0;
+	uint32_t		_rotations				= 0;
+	uint32_t		_failures				= 0;
+	uint32_t		_totalFlushUs			= 0;
+	uint32_t		_maxFlushUs				= 0;
+
+	LinePrinter *	_source					= nullptr;
+	FunctionId		_sourceId				= 0;
+	FunctionId		_awakeId				= 0;
+	FunctionId		_shutdownId				= 0;
+
+	void fileName							(char * name, uint8_t index) const;
+	void rotate								();
+	void writeBlock							();
+
+public:
+
+	// A prefix too long for FILE_LOG_SINK_NAME_LEN is replaced by FILE_LOG_SINK_PREFIX
+	FileLogSink								(fs::FS & fs = LittleFS, const char * prefix = FILE_LOG_SINK_PREFIX,
+											 uint8_t fileCount = FILE_LOG_SINK_FILES, size_t maxFileSize = FILE_LOG_SINK_FILE_SIZE);
+	~FileLogSink							();
+
+	// The file system must be mounted (FileStorage::init)
+	void begin								();
+
+	void attach								(LinePrinter & source);
+	void detach								();
+	void attachToSequencer					();
+	void detachFromSequencer				();
+
+	// Print
+	virtual size_t write					(uint8_t character) override	{	return write (&character, 1);	}
+	virtual size_t write					(const uint8_t * buffer, size_t size) override;
+	using Print::write;
+
+	// Write the partial block
+	virtual void flush						() override;
+
+	// Printed bytes (files + RAM block) in the chronological order
+	void printTo							(Print & printer);
+
+	// Logged bytes / (blocks written * block size) : 1 when only full blocks are written (the flash pages really
+	// erased or programmed by the file system are not known)
+	float averageBlockFill					() const;
+	void printStats							(Print & printer);
+	void resetStats							();
+};
+
+}
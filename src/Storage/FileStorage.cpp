@@ -9,10 +9,13 @@
 #include <StreamString.h>
 
 #include "Print/Logger.h"
+#include "Print/LogTag.h"
 #include "FileStorage.h"
 
 namespace corex {
 
+LOG_TAG ("fs");
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -31,7 +34,7 @@ void FileStorage :: spiffsMountFileSystem ()
 {
 	if (!LittleFS.begin())								// always use this to "mount" the filesystem
 	{
-		Logln(F("ERROR : Can't open the LittleFS..."));
+		TLogE(F("ERROR : Can't open the LittleFS..."));
 		return;
 	}
 }
@@ -47,9 +50,9 @@ void FileStorage :: spiffsCheckIfFormatted ()
 	}
 	else {
 		// Next lines have to be done ONLY ONCE!!!!!When LittleFS is formatted ONCE you can comment these lines out!!
-		Logln(F("Please wait 30 secs for LittleFS to be formatted..."));
+		TLogW(F("Please wait 30 secs for LittleFS to be formatted..."));
 		LittleFS.format();
-		Logln(F("OK! Spiffs formatted"));
+		TLogI(F("OK! Spiffs formatted"));
 	}
 }
 
@@ -73,7 +76,7 @@ String FileStorage :: spiffsListFiles ()
 	File root = LittleFS.open("/", "r");
 
 	if (!root) {
-		Logln("- Fails to open root directory");
+		TLogE("- Fails to open root directory");
 		return sstr;
 	}
 
@@ -169,7 +172,7 @@ size_t FileStorage :: spiffsRemainingBytes ()
 bool FileStorage :: spiffsCheckRemainingBytes ()
 {
 	if (spiffsRemainingBytes() < MIN_REMAINING_BYTES) {
-		Logln(F("*** WARNING : available spiffs space is too low !"));
+		TLogW(F("*** WARNING : available spiffs space is too low !"));
 		return false;
 	}
 
@@ -199,7 +202,7 @@ void FileStorage :: spiffsRemoveAllFiles ()
 
 #endif
 
-	Logln(F("All spiffs files were removed!"));
+	TLogI(F("All spiffs files were removed!"));
 }
 
 //========================================================================================================================
@@ -212,7 +215,7 @@ void FileStorage :: spiffsRemoveAllTmpFiles ()
 	Dir dir = LittleFS.openDir("/");
 	while (dir.next()) {
 		if (dir.fileName().startsWith(F(TMP_NAMEFILE_PREFIX))) {
-			Logln(F("Removing tmp file: ") << dir.fileName());
+			TLogD(F("Removing tmp file: ") << dir.fileName());
 			LittleFS.remove (dir.fileName());
 		}
 	}
@@ -223,7 +226,7 @@ void FileStorage :: spiffsRemoveAllTmpFiles ()
 	while (file) {
 		String fileName = file.name();
 		if (fileName.startsWith(F(TMP_NAMEFILE_PREFIX))) {
-			Logln(F("Removing tmp file: ") << file.name());
+			TLogD(F("Removing tmp file: ") << file.name());
 			LittleFS.remove (file.name());
 		}
 		file = root.openNextFile();
@@ -239,11 +242,11 @@ File FileStorage :: createFile (const String & filename)
 {
 	File f = LittleFS.open (filename, "w+");
 	if (!f) {
-		Logln(F("ERROR : Can't create the file : ") << filename);
+		TLogE(F("ERROR : Can't create the file : ") << filename);
 		return f;
 	}
 
-	Logln(F("The file '") << filename << F("' is created"));
+	TLogD(F("The file '") << filename << F("' is created"));
 
 	return f;
 }
@@ -271,7 +274,7 @@ bool FileStorage :: printTextFile (const String & filename, Print & printer) {
 
 	File f = LittleFS.open(filename, "r");
 	if (!f) {
-		Logln(F("Warning : Can't open the file : ") << filename);
+		TLogW(F("Warning : Can't open the file : ") << filename);
 		return false;
 	}
 
@@ -292,7 +295,7 @@ bool FileStorage :: readTextFile (const String & filename, String & text)
 {
 	File f = LittleFS.open(filename, "r");
 	if (!f) {
-		Logln(F("Warning : Can't open the file : ") << filename);
+		TLogW(F("Warning : Can't open the file : ") << filename);
 		return false;
 	}
 	text = f.readStringUntil('\r');
@@ -308,7 +311,7 @@ bool FileStorage :: writeTextFile (const String & filename, const String & text)
 {
 	File f = LittleFS.open(filename, "w");
 	if (!f) {
-		Logln(F("ERROR : Can't create the file : ") << filename);
+		TLogE(F("ERROR : Can't create the file : ") << filename);
 		return false;
 	}
 	f.println (text.c_str());
@@ -345,7 +348,7 @@ void FileStorage :: deleteFile (const String & filename)
 {
 	if (isFileExists (filename)) {
 		LittleFS.remove (filename);
-		Logln(F("The file '") << filename << F("' was deleted"));
+		TLogD(F("The file '") << filename << F("' was deleted"));
 	}
 }
 
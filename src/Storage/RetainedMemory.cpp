@@ -0,0 +1,89 @@
+//************************************************************************************************************************
+// RetainedMemory.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <Arduino.h>
+
+#include "RetainedMemory.h"
+
+#if defined (ESP8266) || defined (ESP32)
+
+namespace corex {
+
+
+SINGLETON_IMPL (RtcRetainedMemory)
+
+
+#ifdef ESP32
+// Not initialized at the boot => kept after a deep sleep or a software reset
+static RTC_NOINIT_ATTR uint8_t rtcRetainedBuffer [RTC_RETAINED_SIZE];
+#endif
+
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RtcRetainedMemory :: read (size_t offset, void * data, size_t len)
+{
+	if (offset + len > RTC_RETAINED_SIZE) return false;
+
+#ifdef ESP8266
+
+	// The RTC memory is read by blocks of 4 bytes
+	uint8_t * dst = (uint8_t *) data;
+	while (len > 0) {
+		uint32_t block;
+		size_t shift = offset & 3;
+		size_t n = 4 - shift;
+		if (n > len) n = len;
+		if (!ESP.rtcUserMemoryRead (RTC_RETAINED_OFFSET_BLOCKS + (offset >> 2), &block, sizeof (block))) return false;
+		memcpy (dst, ((uint8_t *) &block) + shift, n);
+		dst += n; offset += n; len -= n;
+	}
+
+#elif defined (ESP32)
+
+	memcpy (data, rtcRetainedBuffer + offset, len);
+
+#endif
+
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool RtcRetainedMemory :: write (size_t offset, const void * data, size_t len)
+{
+	if (offset + len > RTC_RETAINED_SIZE) return false;
+
+#ifdef ESP8266
+
+	// The RTC memory is written by blocks of 4 bytes => read, modify, write the partial blocks
+	const uint8_t * src = (const uint8_t *) data;
+	while (len > 0) {
+		uint32_t block;
+		uint32_t blockNo = RTC_RETAINED_OFFSET_BLOCKS + (offset >> 2);
+		size_t shift = offset & 3;
+		size_t n = 4 - shift;
+		if (n > len) n = len;
+		if ((n < 4) && !ESP.rtcUserMemoryRead (blockNo, &block, sizeof (block))) return false;
+		memcpy (((uint8_t *) &block) + shift, src, n);
+		if (!ESP.rtcUserMemoryWrite (blockNo, &block, sizeof (block))) return false;
+		src += n; offset += n; len -= n;
+	}
+
+#elif defined (ESP32)
+
+	memcpy (rtcRetainedBuffer + offset, data, len);
+
+#endif
+
+	return true;
+}
+
+}
+
+#endif
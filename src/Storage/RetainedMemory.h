@@ -0,0 +1,73 @@
+//************************************************************************************************************************
+// RetainedMemory.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Tools/Singleton.h"
+
+
+// Part of the RTC user memory used by the library (ESP8266 : 512 bytes of user memory, the first blocks are left to the
+// eboot command of the OTA updates)
+#define RTC_RETAINED_OFFSET_BLOCKS			32						// In blocks of 4 bytes
+#define RTC_RETAINED_SIZE					384						// In bytes, multiple of 4
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Memory which keeps its content after a deep sleep or a reboot (but not after a power loss)
+class RetainedMemory
+{
+public:
+	virtual ~RetainedMemory					() = default;
+
+	virtual size_t size						() const = 0;
+	virtual bool read						(size_t offset, void * data, size_t len) = 0;
+	virtual bool write						(size_t offset, const void * data, size_t len) = 0;
+};
+
+//------------------------------------------------------------------------------
+// Stand-in in RAM (the buffer is given by the caller), to test on Linux
+class RamRetainedMemory : public RetainedMemory
+{
+private:
+	uint8_t *	_buffer;
+	size_t		_size;
+
+public:
+	RamRetainedMemory						(uint8_t * buffer, size_t size) : _buffer (buffer), _size (size) {}
+
+	virtual size_t size						() const override		{	return _size;											}
+	virtual bool read						(size_t offset, void * data, size_t len) override
+																	{	if (offset + len > _size) return false;
+																		memcpy (data, _buffer + offset, len); return true;		}
+	virtual bool write						(size_t offset, const void * data, size_t len) override
+																	{	if (offset + len > _size) return false;
+																		memcpy (_buffer + offset, data, len); return true;		}
+};
+
+#if defined (ESP8266) || defined (ESP32)
+
+//------------------------------------------------------------------------------
+// WARNING : SINGLETON !!!!
+// RTC memory : ESP.rtcUserMemoryRead/Write on ESP8266, RTC_NOINIT_ATTR buffer on ESP32
+class RtcRetainedMemory : public RetainedMemory
+{
+	SINGLETON_CLASS(RtcRetainedMemory)
+
+public:
+	virtual size_t size						() const override		{	return RTC_RETAINED_SIZE;								}
+	virtual bool read						(size_t offset, void * data, size_t len) override;
+	virtual bool write						(size_t offset, const void * data, size_t len) override;
+};
+
+#endif
+
+}
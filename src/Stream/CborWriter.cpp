@@ -0,0 +1,171 @@
+//************************************************************************************************************************
+// CborWriter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <string.h>
+
+#include "CborWriter.h"
+
+
+// Initial bytes of the simple values
+#define CBOR_FALSE						0xF4
+#define CBOR_TRUE						0xF5
+#define CBOR_NULL						0xF6
+#define CBOR_FLOAT32					0xFA
+#define CBOR_FLOAT64					0xFB
+#define CBOR_BREAK						0xFF
+#define CBOR_INDEFINITE					0x1F
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CborWriter :: writeRaw (const uint8_t * data, size_t len)
+{
+	_written += _printer.write (data, len);
+}
+
+//========================================================================================================================
+// Major type + argument in the shortest form (big endian)
+//========================================================================================================================
+void CborWriter :: writeHead (uint8_t major, uint64_t value)
+{
+	uint8_t head [9];
+	size_t len;
+	major <<= 5;
+
+	if (value < 24) {
+		head [0] = major | (uint8_t) value;
+		len = 1;
+	}
+	else if (value <= 0xFF) {
+		head [0] = major | 24;
+		len = 2;
+	}
+	else if (value <= 0xFFFF) {
+		head [0] = major | 25;
+		len = 3;
+	}
+	else if (value <= 0xFFFFFFFF) {
+		head [0] = major | 26;
+		len = 5;
+	}
+	else {
+		head [0] = major | 27;
+		len = 9;
+	}
+
+	for (size_t i = len - 1; i > 0; i--) {
+		head [i] = (uint8_t) value;
+		value >>= 8;
+	}
+
+	writeRaw (head, len);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CborWriter :: beginMap ()
+{
+	uint8_t head = (5 << 5) | CBOR_INDEFINITE;
+	writeRaw (&head, 1);
+}
+
+void CborWriter :: beginArray ()
+{
+	uint8_t head = (4 << 5) | CBOR_INDEFINITE;
+	writeRaw (&head, 1);
+}
+
+void CborWriter :: end ()
+{
+	uint8_t head = CBOR_BREAK;
+	writeRaw (&head, 1);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CborWriter :: writeNull ()
+{
+	uint8_t head = CBOR_NULL;
+	writeRaw (&head, 1);
+}
+
+void CborWriter :: write (bool value)
+{
+	uint8_t head = value ? CBOR_TRUE : CBOR_FALSE;
+	writeRaw (&head, 1);
+}
+
+//========================================================================================================================
+// IEEE 754 big endian
+//========================================================================================================================
+void CborWriter :: write (float value)
+{
+	uint32_t bits;
+	memcpy (&bits, &value, sizeof (bits));
+
+	uint8_t item [5] = { CBOR_FLOAT32, (uint8_t) (bits >> 24), (uint8_t) (bits >> 16), (uint8_t) (bits >> 8), (uint8_t) bits };
+	writeRaw (item, sizeof (item));
+}
+
+void CborWriter :: write (double value)
+{
+	uint64_t bits;
+	memcpy (&bits, &value, sizeof (bits));
+
+	uint8_t item [9];
+	item [0] = CBOR_FLOAT64;
+	for (size_t i = 8; i > 0; i--) {
+		item [i] = (uint8_t) bits;
+		bits >>= 8;
+	}
+	writeRaw (item, sizeof (item));
+}
+
+//========================================================================================================================
+// Text strings (UTF-8)
+//========================================================================================================================
+void CborWriter :: write (const char * text)
+{
+	if (!text) {
+		writeNull ();
+		return;
+	}
+	size_t len = strlen (text);
+	writeHead (3, len);
+	writeRaw ((const uint8_t *) text, len);
+}
+
+void CborWriter :: write (const __FlashStringHelper * text)
+{
+	if (!text) {
+		writeNull ();
+		return;
+	}
+	writeHead (3, strlen_P ((PGM_P) text));
+	_written += _printer.print (text);					// Read from the flash by Print
+}
+
+void CborWriter :: write (const String & text)
+{
+	writeHead (3, text.length ());
+	writeRaw ((const uint8_t *) text.c_str (), text.length ());
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CborWriter :: write (const CborBytes & bytes)
+{
+	writeHead (2, bytes.len);
+	writeRaw (bytes.data, bytes.len);
+}
+
+}
@@ -0,0 +1,108 @@
+//************************************************************************************************************************
+// CborWriter.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include <Print.h>
+
+#include <type_traits>
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Byte string value
+struct CborBytes
+{
+	const uint8_t *	data;
+	size_t			len;
+};
+
+//------------------------------------------------------------------------------
+// Streaming CBOR encoder (RFC 8949) : the items are written directly in the Print (Serial, WiFiClient, MemStream, File...)
+// without intermediate String nor heap allocation. The maps and arrays of known size are written with their size first.
+//
+// Example :
+//		CborWriter cbor (client);
+//		cbor.map ("heap", ESP.getFreeHeap (), "name", F("ESP"), "awake", true);
+//
+class CborWriter
+{
+private:
+	Print &			_printer;
+	size_t			_written			= 0;
+
+	void writeHead						(uint8_t major, uint64_t value);
+	void writeRaw						(const uint8_t * data, size_t len);
+
+	template <typename K, typename V, typename ...Fields>
+	inline void fields					(const K & key, const V & value, const Fields & ...others)
+																	{	write (key); write (value);
+																		if constexpr (sizeof... (others) > 0) fields (others...);		}
+
+public:
+	CborWriter							(Print & printer) : _printer (printer) {}
+
+	size_t written						() const					{	return _written;										}
+
+	// Containers
+	void beginMap						(size_t pairs)				{	writeHead (5, pairs);									}
+	void beginArray						(size_t items)				{	writeHead (4, items);									}
+	void beginMap						();							// Indefinite length, closed by end ()
+	void beginArray						();
+	void end							();
+
+	// Values
+	void writeNull						();
+	void write							(bool value);
+	void write							(float value);
+	void write							(double value);
+	void write							(const char * text);
+	void write							(const __FlashStringHelper * text);
+	void write							(const String & text);
+	void write							(const CborBytes & bytes);
+
+	template <typename T, typename std::enable_if <std::is_integral <T>::value && !std::is_same <T, bool>::value, int>::type = 0>
+	void write							(T value)					{	if constexpr (std::is_signed <T>::value) {
+																			if (value < 0) { writeHead (1, (uint64_t) (-1 - (int64_t) value)); return; }
+																		}
+																		writeHead (0, (uint64_t) value);								}
+
+	// Map of the pairs key, value, key, value... (the size of the map is computed at compile time)
+	template <typename ...Fields>
+	void map							(const Fields & ...pairs)	{	static_assert ((sizeof... (pairs) % 2) == 0, "A map needs a value for each key");
+																		beginMap (sizeof... (pairs) / 2);
+																		if constexpr (sizeof... (pairs) > 0) fields (pairs...);		}
+};
+
+//------------------------------------------------------------------------------
+// Fixed record : the keys are given once, the number and the types of the values are checked by the compiler at each write
+//
+// Example :
+//		static const CborSchema <uint32_t, uint32_t, bool> status ("id", "heap", "awake");
+//		status.write (cbor, EspBoard::getDeviceId (), ESP.getFreeHeap (), true);
+//
+template <typename ...Values>
+class CborSchema
+{
+private:
+	const char *	_keys [sizeof... (Values)];
+
+public:
+	static constexpr size_t size = sizeof... (Values);
+
+	template <typename ...Keys>
+	constexpr CborSchema				(Keys ...keys) : _keys { keys... }
+																	{	static_assert (sizeof... (Keys) == sizeof... (Values), "A key is needed for each value");	}
+
+	void write							(CborWriter & cbor, const Values & ...values) const
+																	{	cbor.beginMap (size);
+																		size_t i = 0;
+																		((cbor.write (_keys [i++]), cbor.write (values)), ...);		}
+};
+
+}
@@ -0,0 +1,255 @@
+//************************************************************************************************************************
+// CmdBinaryParser.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Tools/Crc.h"
+#include "Print/Format.h"
+
+#include "CmdBinaryParser.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CmdBinaryParser :: CmdBinaryParser (bool responses) :
+	_kind (responses ? CMD_BINARY_RESPONSE : CMD_BINARY_COMMAND)
+{
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdBinaryParser :: reset ()
+{
+	_len = 0;
+	_remaining = 0;
+	_code = 0;
+	_overflow = false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdBinaryParser :: append (uint8_t byte)
+{
+	if (_len < CMD_BINARY_FRAME_LEN) _frame [_len++] = byte;
+	else _overflow = true;
+}
+
+//========================================================================================================================
+// COBS : each block starts with its code (1 + number of bytes before the next zero), 0xFF => block without zero
+//========================================================================================================================
+bool CmdBinaryParser :: decode (uint8_t byte)
+{
+	if (byte == CMD_BINARY_DELIMITER) {
+		bool done = false;
+		if (_code != 0) {
+			if (!_overflow && (_remaining == 0) && decodeFrame ()) done = true;
+			else _errors++;
+		}
+		reset ();
+		return done;
+	}
+
+	if (_remaining == 0) {
+		// The zero which ends the previous block (if any)
+		if ((_code != 0) && (_code != 0xFF)) append (0);
+		_code = byte;
+		_remaining = byte - 1;
+	}
+	else {
+		append (byte);
+		_remaining--;
+	}
+	return false;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+static bool readVarint (const uint8_t * & p, const uint8_t * end, uint32_t & value)
+{
+	value = 0;
+	for (uint8_t shift = 0; (p < end) && (shift < 32); shift += 7) {
+		uint8_t byte = *p++;
+		value |= (uint32_t) (byte & 0x7F) << shift;
+		if (!(byte & 0x80)) return true;
+	}
+	return false;
+}
+
+//========================================================================================================================
+// [kind][id][len][bytes]...[crc]
+//========================================================================================================================
+bool CmdBinaryParser :: decodeFrame ()
+{
+	if (_len < 4) return false;
+
+	size_t payload = _len - 2;
+	uint16_t crc = _frame [payload] | (_frame [payload + 1] << 8);
+	if (crc16 (_frame, payload) != crc) return false;
+	if (_frame [0] != _kind) return false;
+
+	const uint8_t * p = _frame + 1;
+	const uint8_t * end = _frame + payload;
+
+	uint32_t id;
+	if (!readVarint (p, end, id) || (id > 0xFFFF)) return false;
+
+	_params.clear ();
+	while (p < end) {
+		uint32_t len;
+		if (!readVarint (p, end, len) || (len > (size_t) (end - p))) return false;
+		if (!_params.add (CmdParamView ((const char *) p, len))) return false;
+		p += len;
+	}
+
+	_commands++;
+	notifyCommand ((int) id, _params);
+	return true;
+}
+
+
+
+
+//************************************************************************************************************************
+//************************************************************************************************************************
+//************************************************************************************************************************
+
+
+
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdBinaryWriter :: begin (uint8_t kind, uint16_t id)
+{
+	_len = 0;
+	_overflow = false;
+	_frame [_len++] = kind;
+	appendVarint (id);
+}
+
+//========================================================================================================================
+// LEB128
+//========================================================================================================================
+void CmdBinaryWriter :: appendVarint (uint32_t value)
+{
+	do {
+		uint8_t byte = value & 0x7F;
+		value >>= 7;
+		if (value) byte |= 0x80;
+		appendBytes (&byte, 1);
+	} while (value);
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdBinaryWriter :: appendBytes (const uint8_t * data, size_t len)
+{
+	if (_len + len > CMD_BINARY_FRAME_LEN - 2) {			// Keep room for the crc
+		_overflow = true;
+		return;
+	}
+	memcpy (_frame + _len, data, len);
+	_len += len;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdBinaryWriter :: param (const uint8_t * data, size_t len)
+{
+	appendVarint (len);
+	appendBytes (data, len);
+}
+
+void CmdBinaryWriter :: param (const char * text)
+{
+	param ((const uint8_t *) text, strlen (text));
+}
+
+void CmdBinaryWriter :: param (long value)
+{
+	char number [FMT_DEC_U32_LEN + 2];
+	size_t len = 0;
+	if (value < 0) {
+		number [len++] = '-';
+		len += fmt::toDec (number + len, 0u - (uint32_t) value);
+	}
+	else {
+		len += fmt::toDec (number + len, (uint32_t) value);
+	}
+	param ((const uint8_t *) number, len);
+}
+
+void CmdBinaryWriter :: param (unsigned long value)
+{
+	char number [FMT_DEC_U32_LEN + 1];
+	param ((const uint8_t *) number, fmt::toDec (number, (uint32_t) value));
+}
+
+void CmdBinaryWriter :: param (long long value)
+{
+	char number [22];
+	param ((const uint8_t *) number, snprintf (number, sizeof (number), "%lld", value));
+}
+
+void CmdBinaryWriter :: param (unsigned long long value)
+{
+	char number [22];
+	param ((const uint8_t *) number, snprintf (number, sizeof (number), "%llu", value));
+}
+
+void CmdBinaryWriter :: param (double value)
+{
+	char number [32];
+	param ((const uint8_t *) number, snprintf (number, sizeof (number), "%.15g", value));
+}
+
+void CmdBinaryWriter :: param (float value)
+{
+	char number [24];
+	param ((const uint8_t *) number, snprintf (number, sizeof (number), "%.7g", (double) value));
+}
+
+//========================================================================================================================
+// Crc, then COBS encoding block by block in the Print
+//========================================================================================================================
+size_t CmdBinaryWriter :: end (Print & printer)
+{
+	if (_overflow) return 0;
+
+	uint16_t crc = crc16 (_frame, _len);
+	_frame [_len++] = crc;
+	_frame [_len++] = crc >> 8;
+
+	size_t written = 0;
+	size_t begin = 0;
+
+	while (true) {
+		// Block : the bytes until the next zero (254 bytes max)
+		size_t end = begin;
+		while ((end < _len) && (_frame [end] != 0) && (end - begin < 254)) end++;
+
+		uint8_t code = end - begin + 1;
+		written += printer.write (code);
+		written += printer.write (_frame + begin, end - begin);
+
+		if (end >= _len) break;								// The last zero is implied by the delimiter
+		begin = (_frame [end] == 0) ? end + 1 : end;		// The zero is replaced by the code of the next block
+	}
+
+	written += printer.write ((uint8_t) CMD_BINARY_DELIMITER);
+	return written;
+}
+
+}
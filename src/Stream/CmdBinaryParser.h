@@ -0,0 +1,119 @@
+//************************************************************************************************************************
+// CmdBinaryParser.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#include "CmdFrameDecoder.h"
+
+
+// Frame : COBS ( [kind][id:varint]([len:varint][bytes])...[crc16:2] ) 0x00
+// The crc (CRC-16/CCITT-FALSE, little endian) is computed on kind, id and params
+#define CMD_BINARY_COMMAND				0x01
+#define CMD_BINARY_RESPONSE				0x02
+
+#define CMD_BINARY_FRAME_LEN			(CMD_PARAMS_LINE_LEN + 2 * CMD_MAX_PARAMS + 8)		// Decoded frame
+#define CMD_BINARY_DELIMITER			0x00
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Incremental decoder of the binary frames : same notification than CmdFrameParser (the params are byte strings, a
+// numeric param is sent as text by CmdBinaryWriter => the same handlers for the two framings)
+// A frame with a bad crc, a bad kind or too long is dropped (counted), the next 0x00 resynchronizes the decoder.
+// Its gain is the binary payloads and the crc, not the speed : on a short command a frame is only 1 or 2 bytes shorter
+// than the text one (">> [12/on|250]" : 14 bytes, 13 in binary => 822 against 886 commands/s at 115200 bauds), and the
+// decoding is slower on a x86 host (133 ns against 80 ns per command, crc without table).
+//
+class CmdBinaryParser : public CmdFrameDecoder
+{
+private:
+
+	uint8_t			_kind;
+	uint8_t			_frame [CMD_BINARY_FRAME_LEN];			// Decoded (COBS) bytes
+	size_t			_len				= 0;
+	uint8_t			_remaining			= 0;				// Bytes of the current COBS block
+	uint8_t			_code				= 0;				// Code of the current COBS block
+	bool			_overflow			= false;
+	CmdParamList	_params;
+
+	void append						(uint8_t byte);
+	bool decodeFrame				();
+
+public:
+
+	CmdBinaryParser					(bool responses = false);
+
+	// Non-virtual, inlined in the loops of feed and poll
+	bool decode						(uint8_t byte);
+
+	virtual bool feed				(uint8_t byte) override	{	return decode (byte);								}
+	virtual size_t feed				(const uint8_t * data, size_t len) override
+															{	return feedAll (*this, data, len);					}
+	virtual size_t poll				(Stream & stream) override
+															{	return pollAll (*this, stream);						}
+	virtual void reset				() override;
+};
+
+//------------------------------------------------------------------------------
+// Encoder of a binary frame : the frame is built in a fixed buffer, then COBS encoded directly in the Print
+//
+// Example :
+//		CmdBinaryWriter::writeCommand (client, 12, "on", 250);
+//
+class CmdBinaryWriter
+{
+private:
+
+	uint8_t			_frame [CMD_BINARY_FRAME_LEN];
+	size_t			_len				= 0;
+	bool			_overflow			= false;
+
+	void appendVarint				(uint32_t value);
+	void appendBytes				(const uint8_t * data, size_t len);
+
+	template <typename T>
+	void params						(const T & value)		{	param (value);										}
+	template <typename T, typename ...Others>
+	void params						(const T & value, const Others & ...others)
+															{	param (value); params (others...);					}
+
+public:
+
+	void begin						(uint8_t kind, uint16_t id);
+	void param						(const uint8_t * data, size_t len);
+	void param						(const char * text);
+	void param						(const String & text)	{	param ((const uint8_t *) text.c_str (), text.length ());	}
+	void param						(long value);			// As text
+	void param						(int value)				{	param ((long) value);								}
+	void param						(unsigned long value);
+	void param						(unsigned int value)	{	param ((unsigned long) value);						}
+	void param						(long long value);
+	void param						(unsigned long long value);
+	void param						(double value);			// As text, 15 significant digits
+	void param						(float value);			// As text, 7 significant digits
+
+	// Return the number of bytes written (0 if the frame is too long)
+	size_t end						(Print & printer);
+
+	template <typename ...Params>
+	static size_t writeCommand		(Print & printer, uint16_t id, const Params & ...values)
+															{	CmdBinaryWriter writer;
+																writer.begin (CMD_BINARY_COMMAND, id);
+																if constexpr (sizeof... (values) > 0) writer.params (values...);
+																return writer.end (printer);						}
+
+	template <typename ...Params>
+	static size_t writeResponse		(Print & printer, uint16_t id, const Params & ...values)
+															{	CmdBinaryWriter writer;
+																writer.begin (CMD_BINARY_RESPONSE, id);
+																if constexpr (sizeof... (values) > 0) writer.params (values...);
+																return writer.end (printer);						}
+};
+
+}
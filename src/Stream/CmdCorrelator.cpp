@@ -0,0 +1,190 @@
+//************************************************************************************************************************
+// CmdCorrelator.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Print/Logger.h"
+
+#include "CmdCorrelator.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CmdCorrelator :: CmdCorrelator ()
+{
+	_responses.notifyCommand.push_back ("CmdCorrelator", [this] (int id, const CmdParamList & params) {
+		onResponse (id, params);
+	});
+}
+
+//========================================================================================================================
+// Free entry + insertion in the list sorted by deadline (from the end : the timeout is the same for most commands)
+//========================================================================================================================
+int CmdCorrelator :: reserve (uint16_t id, CmdCompletion done)
+{
+	int8_t index = -1;
+	for (int8_t i = 0; i < CMD_CORRELATOR_DEPTH; i++) {
+		if (!_pending [i].used) { index = i; break; }
+	}
+	if (index < 0) return -1;
+
+	uint32_t now = millis ();
+	Pending & pending = _pending [index];
+	pending.done		= done;
+	pending.sentMs		= now;
+	pending.deadlineMs	= now + _timeoutMs;
+	pending.seq			= _seq++;
+	pending.id			= id;
+	pending.used		= true;
+	pending.next		= -1;
+
+	// Last entry whose deadline is before the new one
+	int8_t prev = -1;
+	for (int8_t i = _first; i >= 0; i = _pending [i].next) {
+		if ((int32_t) (_pending [i].deadlineMs - pending.deadlineMs) > 0) break;
+		prev = i;
+	}
+	if (prev < 0) {
+		pending.next = _first;
+		_first = index;
+	}
+	else {
+		pending.next = _pending [prev].next;
+		_pending [prev].next = index;
+	}
+
+	_count++;
+	_sent++;
+	return pending.seq;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdCorrelator :: unlink (int8_t index)
+{
+	if (_first == index) {
+		_first = _pending [index].next;
+	}
+	else {
+		for (int8_t i = _first; i >= 0; i = _pending [i].next) {
+			if (_pending [i].next == index) { _pending [i].next = _pending [index].next; break; }
+		}
+	}
+	_pending [index].used = false;
+	_pending [index].next = -1;
+	_count--;
+}
+
+//========================================================================================================================
+// The entry is released before the callback => the callback can send the next command
+//========================================================================================================================
+void CmdCorrelator :: complete (int8_t index, CmdStatus status, const CmdParamList & params)
+{
+	CmdCompletion done = std::move (_pending [index].done);
+	uint16_t id = _pending [index].id;
+	_pending [index].done = nullptr;
+	unlink (index);
+
+	if (done) done (status, id, params);
+}
+
+//========================================================================================================================
+// << [id:#seq|p1|p2]
+//========================================================================================================================
+void CmdCorrelator :: onResponse (int id, const CmdParamList & params)
+{
+	uint16_t seq;
+	if ((params.size () == 0) || !params [0].parseSeqTag (seq)) {
+		_unmatched++;
+		return;
+	}
+
+	for (int8_t i = 0; i < CMD_CORRELATOR_DEPTH; i++) {
+		Pending & pending = _pending [i];
+		if (!pending.used || (pending.seq != seq) || (pending.id != id)) continue;
+
+		uint32_t rtt = millis () - pending.sentMs;
+		if (rtt > _maxRttMs) _maxRttMs = rtt;
+		_completed++;
+		_windowCompleted++;
+
+		complete (i, CmdStatus::Ok, params.from (1));
+		return;
+	}
+
+	// Response after its timeout or not ours
+	_unmatched++;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdCorrelator :: update ()
+{
+	uint32_t now = millis ();
+
+	// A command sent by a callback has a deadline after now (timeout >= 1 ms)
+	while ((_first >= 0) && ((int32_t) (now - _pending [_first].deadlineMs) >= 0)) {
+		_timeouts++;
+		complete (_first, CmdStatus::Timeout, CmdParamList ());
+	}
+
+	uint32_t elapsed = now - _windowStartMs;
+	if (elapsed >= CMD_CORRELATOR_RATE_WINDOW_MS) {
+		_rate = _windowCompleted * 1000.0f / elapsed;
+		_windowCompleted = 0;
+		_windowStartMs = now;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdCorrelator :: cancelAll ()
+{
+	// Only the commands pending now : a callback can send a new command
+	int8_t indexes [CMD_CORRELATOR_DEPTH];
+	uint16_t seqs [CMD_CORRELATOR_DEPTH];
+	uint8_t count = 0;
+	for (int8_t i = _first; i >= 0; i = _pending [i].next) {
+		indexes [count] = i;
+		seqs [count++] = _pending [i].seq;
+	}
+
+	for (uint8_t i = 0; i < count; i++) {
+		Pending & pending = _pending [indexes [i]];
+		if (pending.used && (pending.seq == seqs [i])) complete (indexes [i], CmdStatus::Cancelled, CmdParamList ());
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdCorrelator :: printStats (Print & printer) const
+{
+	printer << F("Commands sent: ") << _sent << F(", completed: ") << _completed << F(", timeouts: ") << _timeouts
+			<< F(", unmatched: ") << _unmatched << F(", pending: ") << _count << LN;
+	printer << F("Max round trip: ") << _maxRttMs << F("ms, rate: ") << _rate << F(" cmd/s") << LN;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdCorrelator :: resetStats ()
+{
+	_sent = 0;
+	_completed = 0;
+	_timeouts = 0;
+	_unmatched = 0;
+	_maxRttMs = 0;
+	_windowStartMs = millis ();
+	_windowCompleted = 0;
+	_rate = 0;
+}
+
+}
@@ -0,0 +1,120 @@
+//************************************************************************************************************************
+// CmdCorrelator.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <functional>
+
+#include "Print/LinePrinter.h"
+
+#include "StreamParser.h"
+#include "StreamCmdParser.h"
+#include "CmdFrameParser.h"
+
+
+#define CMD_CORRELATOR_DEPTH			8						// Max number of commands waiting for their response
+#define CMD_CORRELATOR_TIMEOUT_MS		1000
+#define CMD_CORRELATOR_RATE_WINDOW_MS	1000					// Window of the measure of the commands per second
+
+
+namespace corex {
+
+enum class CmdStatus : uint8_t { Ok, Timeout, Cancelled };
+
+// params : the params of the response after the sequence tag (views valid during the call only, empty if not Ok)
+using CmdCompletion = std::function <void (CmdStatus status, uint16_t id, const CmdParamList & params)>;
+
+//------------------------------------------------------------------------------
+// Client side of a pipelined link : up to CMD_CORRELATOR_DEPTH commands are sent without waiting for their responses.
+// Each command carries a sequence tag as first param (">> [id/#seq|p1|p2]"), the node repeats it in its response
+// ("<< [id:#seq|...]", see PRINT_RESP_T) => the responses can arrive in any order. On the node, a CommandRouter strips
+// the tag before the handler and repeats it in the response (CmdReply).
+// The responses are read by a CmdFrameParser in response mode : never waits for a byte, a response split in several
+// packets does not stall the other ones.
+// The pending commands are chained by deadline : update () only checks the first one.
+//
+// Example :
+//		correlator.send (client, 12, [] (CmdStatus status, uint16_t id, const CmdParamList & params) {
+//			if (status == CmdStatus::Ok) Logln (F("led ") << params [0]);
+//		}, 4, F("on"));
+//		...
+//		correlator.poll (client);
+//		correlator.update ();
+//
+class CmdCorrelator : public StreamParser
+{
+private:
+
+	struct Pending {
+		CmdCompletion	done;
+		uint32_t		sentMs			= 0;
+		uint32_t		deadlineMs		= 0;
+		uint16_t		seq				= 0;
+		uint16_t		id				= 0;
+		bool			used			= false;
+		int8_t			next			= -1;				// Next pending by deadline
+	};
+
+	CmdFrameParser	_responses			{ true };
+	Pending			_pending [CMD_CORRELATOR_DEPTH];
+	int8_t			_first				= -1;				// Pending with the nearest deadline
+	uint8_t			_count				= 0;
+	uint16_t		_seq				= 0;
+	uint32_t		_timeoutMs			= CMD_CORRELATOR_TIMEOUT_MS;
+
+	uint32_t		_sent				= 0;
+	uint32_t		_completed			= 0;
+	uint32_t		_timeouts			= 0;
+	uint32_t		_unmatched			= 0;
+	uint32_t		_maxRttMs			= 0;
+	uint32_t		_windowStartMs		= 0;
+	uint32_t		_windowCompleted	= 0;
+	float			_rate				= 0;
+
+	int reserve						(uint16_t id, CmdCompletion done);
+	void unlink						(int8_t index);
+	void complete					(int8_t index, CmdStatus status, const CmdParamList & params);
+	void onResponse					(int id, const CmdParamList & params);
+
+public:
+
+	CmdCorrelator					();
+	CmdCorrelator					(const CmdCorrelator &) = delete;
+	CmdCorrelator & operator =		(const CmdCorrelator &) = delete;
+
+	// Send a command with its params, return its sequence tag or -1 if too many commands are pending
+	template <typename ...Params>
+	int send						(Print & printer, uint16_t id, CmdCompletion done, const Params & ...params)
+															{	int seq = reserve (id, done);
+																if (seq < 0) return -1;
+																printer << F(CMD_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_CMD_PARAM)
+																		<< F(MSG_SEQ_TAG) << seq;
+																((printer << F(MSG_SEPARATOR_PARAM) << params), ...);
+																printer << F(MSG_TAG_END) << LN;
+																return seq;											}
+
+	// Read the available bytes (never waits) and complete the commands of the responses, return the number of responses
+	size_t poll						(Stream & stream)		{	return _responses.poll (stream);					}
+	size_t feed						(const uint8_t * data, size_t len)
+															{	return _responses.feed (data, len);					}
+	// Same as poll (the printer is not used)
+	virtual bool parse				(Stream & stream, Print & printer) override
+															{	return poll (stream) > 0;							}
+
+	// Complete the commands whose deadline is passed (to call in the loop)
+	void update						();
+	void cancelAll					();
+
+	void setTimeout					(uint32_t timeoutMs)	{	_timeoutMs = timeoutMs ? timeoutMs : 1;				}
+	uint8_t pending					() const				{	return _count;										}
+	bool isFull						() const				{	return _count >= CMD_CORRELATOR_DEPTH;				}
+	float commandsPerSecond			() const				{	return _rate;										}
+
+	void printStats					(Print & printer) const;
+	void resetStats					();
+};
+
+}
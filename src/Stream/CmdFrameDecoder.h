@@ -0,0 +1,68 @@
+//************************************************************************************************************************
+// CmdFrameDecoder.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Stream.h>
+
+#include "Tools/Signal.h"
+#include "CmdParamView.h"
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Incremental decoder of the commands of a stream, whatever the framing (text or binary) : the bytes are pushed as they
+// arrive and each completed command is notified with its id and the views of its params (valid during the notification
+// only) => the same handlers for all the framings, the framing is chosen for each stream.
+//
+class CmdFrameDecoder
+{
+protected:
+
+	uint32_t		_commands			= 0;
+	uint32_t		_errors				= 0;
+
+	// Loops of the derived decoders on their non-virtual decode (one virtual call per chunk, not per byte)
+	template <class Decoder>
+	static size_t feedAll			(Decoder & decoder, const uint8_t * data, size_t len)
+															{	size_t count = 0;
+																for (size_t i = 0; i < len; i++) {
+																	if (decoder.decode (data [i])) count++;
+																}
+																return count;										}
+	template <class Decoder>
+	static size_t pollAll			(Decoder & decoder, Stream & stream)
+															{	size_t count = 0;
+																for (int available = stream.available (); available > 0; available--) {
+																	int byte = stream.read ();
+																	if (byte < 0) break;
+																	if (decoder.decode ((uint8_t) byte)) count++;
+																}
+																return count;										}
+
+public:
+
+	Signal <int, const CmdParamList &>	notifyCommand;
+
+public:
+
+	virtual ~CmdFrameDecoder		() = default;
+
+	// Return true if a command was completed by this byte
+	virtual bool feed				(uint8_t byte) = 0;
+	virtual void reset				() = 0;
+
+	// Return the number of completed commands
+	virtual size_t feed				(const uint8_t * data, size_t len) = 0;
+	// Never waits : only the bytes available now
+	virtual size_t poll				(Stream & stream) = 0;
+
+	uint32_t commands				() const				{	return _commands;									}
+	uint32_t errors					() const				{	return _errors;										}
+};
+
+}
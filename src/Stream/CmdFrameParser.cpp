@@ -0,0 +1,179 @@
+//************************************************************************************************************************
+// CmdFrameParser.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <string.h>
+
+#include "CmdFrameParser.h"
+
+
+#define CMD_FRAME_START					CMD_START MSG_TAG_BEGIN
+#define RESP_FRAME_START				RESP_START MSG_TAG_BEGIN
+
+static_assert ((sizeof (MSG_TAG_END) == 2) && (sizeof (MSG_SEPARATOR_CMD) == 2) && (sizeof (MSG_SEPARATOR_PARAM) == 2) &&
+			   (sizeof (MSG_SEPARATOR_CMD_PARAM) == 2) && (sizeof (MSG_SEPARATOR_RESP_PARAM) == 2), "The separators must be one char");
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CmdFrameParser :: CmdFrameParser (bool responses) :
+	_start				(responses ? RESP_FRAME_START : CMD_FRAME_START),
+	_paramSeparator		(responses ? MSG_SEPARATOR_RESP_PARAM [0] : MSG_SEPARATOR_CMD_PARAM [0]),
+	_multiCmd			(!responses)
+{
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdFrameParser :: reset ()
+{
+	_state = State::Start;
+	_matched = 0;
+	_id = -1;
+	_lineLen = 0;
+	_paramBegin = 0;
+	_params.clear ();
+}
+
+//========================================================================================================================
+// Longest start of frame which ends with the chars already matched followed by c (the start is only 4 chars)
+//========================================================================================================================
+uint8_t CmdFrameParser :: resync (uint8_t matched, char c) const
+{
+	for (uint8_t len = matched + 1; len > 0; len--) {
+		// _start [0..len-1) must be equal to the last chars matched, and _start [len-1] to c
+		if (_start [len - 1] != c) continue;
+		if (strncmp (_start, _start + matched - (len - 1), len - 1) == 0) return len;
+	}
+	return 0;
+}
+
+//========================================================================================================================
+// View on the chars of the line since the previous separator
+//========================================================================================================================
+void CmdFrameParser :: endParam ()
+{
+	if (!_params.add (CmdParamView (_line + _paramBegin, _lineLen - _paramBegin))) {
+		fail ();
+		return;
+	}
+	_paramBegin = _lineLen;
+}
+
+//========================================================================================================================
+// Notify the command and prepare the next one
+//========================================================================================================================
+bool CmdFrameParser :: endCommand ()
+{
+	if (_id < 0) {
+		fail ();
+		return false;
+	}
+
+	_commands++;
+	notifyCommand (_id, _params);
+
+	_id = -1;
+	_lineLen = 0;
+	_paramBegin = 0;
+	_params.clear ();
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CmdFrameParser :: fail ()
+{
+	_errors++;
+	reset ();
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CmdFrameParser :: decode (uint8_t byte)
+{
+	char c = (char) byte;
+
+	switch (_state)
+	{
+	case State::Start:
+		_matched = resync (_matched, c);
+		if (_start [_matched] == 0) {
+			_state = State::Id;
+			_matched = 0;
+			_id = -1;
+		}
+		return false;
+
+	case State::Id:
+		if ((c >= '0') && (c <= '9')) {
+			_id = ((_id < 0) ? 0 : _id * 10) + (c - '0');
+			if (_id > 0xFFFF) fail ();
+			return false;
+		}
+		if (c == _paramSeparator) {
+			_state = State::Param;
+			_lineLen = 0;
+			_paramBegin = 0;
+			_params.clear ();
+			return false;
+		}
+		if (c == MSG_TAG_END [0]) {
+			bool done = endCommand ();
+			reset ();
+			return done;
+		}
+		if (_multiCmd && (c == MSG_SEPARATOR_CMD [0])) {
+			return endCommand ();
+		}
+		fail ();
+		// This byte can be the start of the next frame
+		_matched = resync (0, c);
+		return false;
+
+	case State::Param:
+		// A frame which lost its end : resynchronize on the start of the next one
+		_matched = resync (_matched, c);
+		if (_start [_matched] == 0) {
+			fail ();
+			_state = State::Id;
+			return false;
+		}
+
+		if (c == MSG_SEPARATOR_PARAM [0]) {
+			endParam ();
+		}
+		else if (c == MSG_TAG_END [0]) {
+			endParam ();
+			if (_state != State::Param) return false;			// Too many params
+			bool done = endCommand ();
+			reset ();
+			return done;
+		}
+		else if (_multiCmd && (c == MSG_SEPARATOR_CMD [0])) {
+			endParam ();
+			if (_state != State::Param) return false;
+			_state = State::Id;
+			return endCommand ();
+		}
+		else if (_lineLen < CMD_PARAMS_LINE_LEN) {
+			_line [_lineLen++] = c;
+		}
+		else {
+			fail ();											// Params too long
+		}
+		return false;
+	}
+
+	return false;
+}
+
+}
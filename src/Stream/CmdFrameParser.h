@@ -0,0 +1,73 @@
+//************************************************************************************************************************
+// CmdFrameParser.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Stream.h>
+
+#include "StreamCmdParser.h"
+#include "CmdFrameDecoder.h"
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Incremental parser of the frames ">> [id/param|param,id/param]" (or "<< [id:param|param]" in response mode) : the bytes
+// are pushed as they arrive (byte, chunk or what is available in a stream), the position in the grammar is kept between
+// the calls => never waits for the next byte (no parseInt, no timeout) and never reads a byte twice.
+// Each completed command is notified with its id and the views of its params (valid during the notification only).
+// A malformed frame is dropped (counted) and the parser looks for the next start of frame (also found in the params of a
+// frame which lost its end).
+//
+// Example :
+//		CmdFrameParser parser;
+//		parser.notifyCommand += [] (int id, const CmdParamList & params) { long value = params [0].toInt (); ... };
+//		void loop () { parser.poll (client); }
+//
+class CmdFrameParser : public CmdFrameDecoder
+{
+private:
+
+	enum class State : uint8_t {
+		Start,												// Looking for ">> [" (_matched chars already found)
+		Id,
+		Param
+	};
+
+	const char *	_start;									// ">> [" or "<< ["
+	char			_paramSeparator;						// '/' or ':'
+	bool			_multiCmd;								// ',' separates the commands of a frame
+
+	State			_state				= State::Start;
+	uint8_t			_matched			= 0;
+	int32_t			_id					= -1;
+
+	char			_line [CMD_PARAMS_LINE_LEN];			// The params of the current command
+	uint8_t			_lineLen			= 0;
+	uint8_t			_paramBegin			= 0;				// Offset of the current param
+	CmdParamList	_params;
+
+	uint8_t resync					(uint8_t matched, char c) const;
+	void endParam					();
+	bool endCommand					();
+	void fail						();
+
+public:
+
+	CmdFrameParser					(bool responses = false);
+
+	// Non-virtual, inlined in the loops of feed and poll
+	bool decode						(uint8_t byte);
+
+	virtual bool feed				(uint8_t byte) override	{	return decode (byte);								}
+	virtual size_t feed				(const uint8_t * data, size_t len) override
+															{	return feedAll (*this, data, len);					}
+	virtual size_t poll				(Stream & stream) override
+															{	return pollAll (*this, stream);						}
+	virtual void reset				() override;
+};
+
+}
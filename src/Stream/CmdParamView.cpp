@@ -0,0 +1,204 @@
+//************************************************************************************************************************
+// CmdParamView.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include <WCharacter.h>
+
+#include "Print/Format.h"
+
+#include "StreamCmdParser.h"
+#include "CmdParamView.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CmdParamView :: equals (const char * str) const
+{
+	return (strlen (str) == _len) && (strncmp (str, _data, _len) == 0);
+}
+
+bool CmdParamView :: equals (const __FlashStringHelper * str) const
+{
+	PGM_P p = (PGM_P) str;
+	for (size_t i = 0; i < _len; i++) {
+		if (pgm_read_byte (p + i) != (uint8_t) _data [i]) return false;
+	}
+	return pgm_read_byte (p + _len) == 0;
+}
+
+//========================================================================================================================
+// Case insensitive
+//========================================================================================================================
+static bool equalsIgnoreCase (const char * data, size_t len, const char * str)
+{
+	for (size_t i = 0; i < len; i++) {
+		if ((str [i] == 0) || (tolower (data [i]) != str [i])) return false;
+	}
+	return str [len] == 0;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CmdParamView :: parseInt (long & value) const
+{
+	size_t i = 0;
+	bool negative = false;
+
+	if ((i < _len) && ((_data [i] == '-') || (_data [i] == '+'))) {
+		negative = (_data [i] == '-');
+		i++;
+	}
+
+	// Max of the absolute value (LONG_MIN has no positive opposite)
+	const unsigned long limit = negative ? (unsigned long) LONG_MAX + 1 : (unsigned long) LONG_MAX;
+
+	unsigned long result = 0;
+	bool hex = (i + 1 < _len) && (_data [i] == '0') && ((_data [i + 1] == 'x') || (_data [i + 1] == 'X'));
+	if (hex) i += 2;
+	if (i >= _len) return false;
+
+	for (; i < _len; i++) {
+		uint8_t digit;
+		if (hex) {
+			if (!isHexadecimalDigit (_data [i])) return false;
+			digit = fmt::hexValue (_data [i]);
+			if (result > ((limit - digit) >> 4)) return false;				// Overflow
+			result = (result << 4) | digit;
+		}
+		else {
+			if (!isDigit (_data [i])) return false;
+			digit = _data [i] - '0';
+			if (result > (limit - digit) / 10) return false;				// Overflow
+			result = result * 10 + digit;
+		}
+	}
+
+	value = negative ? (long) (0ul - result) : (long) result;
+	return true;
+}
+
+//========================================================================================================================
+// [+-]digits[.digits][e[+-]digits]
+//========================================================================================================================
+bool CmdParamView :: parseFloat (float & value) const
+{
+	size_t i = 0;
+	bool negative = false;
+	bool digits = false;
+
+	if ((i < _len) && ((_data [i] == '-') || (_data [i] == '+'))) {
+		negative = (_data [i] == '-');
+		i++;
+	}
+
+	float result = 0;
+	for (; (i < _len) && isDigit (_data [i]); i++) {
+		result = result * 10 + (_data [i] - '0');
+		digits = true;
+	}
+
+	if ((i < _len) && (_data [i] == '.')) {
+		float scale = 0.1f;
+		for (i++; (i < _len) && isDigit (_data [i]); i++) {
+			result += (_data [i] - '0') * scale;
+			scale *= 0.1f;
+			digits = true;
+		}
+	}
+	if (!digits) return false;
+
+	if ((i < _len) && ((_data [i] == 'e') || (_data [i] == 'E'))) {
+		CmdParamView exponent (_data + i + 1, _len - i - 1);
+		long e;
+		if (!exponent.parseInt (e)) return false;
+		// The exponent comes from the network : stop as soon as the result saturates (a few tens of loops at most)
+		for (; (e > 0) && (result != 0) && !isinf (result); e--) result *= 10;
+		for (; (e < 0) && (result != 0); e++) result /= 10;
+		if (isinf (result)) return false;
+		i = _len;
+	}
+	if (i != _len) return false;
+
+	value = negative ? -result : result;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CmdParamView :: parseBool (bool & value) const
+{
+	if (equalsIgnoreCase (_data, _len, "1") || equalsIgnoreCase (_data, _len, "true") ||
+		equalsIgnoreCase (_data, _len, "on") || equalsIgnoreCase (_data, _len, "yes")) {
+		value = true;
+		return true;
+	}
+	if (equalsIgnoreCase (_data, _len, "0") || equalsIgnoreCase (_data, _len, "false") ||
+		equalsIgnoreCase (_data, _len, "off") || equalsIgnoreCase (_data, _len, "no")) {
+		value = false;
+		return true;
+	}
+	return false;
+}
+
+//========================================================================================================================
+// MSG_SEQ_TAG followed by a 16 bits number
+//========================================================================================================================
+bool CmdParamView :: parseSeqTag (uint16_t & seq) const
+{
+	if ((_len < 2) || (_data [0] != MSG_SEQ_TAG [0])) return false;
+
+	long value;
+	if (!CmdParamView (_data + 1, _len - 1).parseInt (value) || (value < 0) || (value > 0xFFFF)) return false;
+	seq = (uint16_t) value;
+	return true;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+size_t CmdParamView :: toHexBytes (uint8_t * bytes, size_t maxBytes) const
+{
+	if ((_len % 2) || (_len / 2 > maxBytes)) return 0;
+
+	for (size_t i = 0; i < _len; i++) {
+		if (!isHexadecimalDigit (_data [i])) return 0;
+	}
+	for (size_t i = 0; i < _len; i += 2) {
+		bytes [i / 2] = (fmt::hexValue (_data [i]) << 4) | fmt::hexValue (_data [i + 1]);
+	}
+	return _len / 2;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+bool CmdParamList :: split (const char * line, size_t len, char separator)
+{
+	_count = 0;
+
+	const char * begin = line;
+	const char * end = line + len;
+	while (true) {
+		const char * next = (const char *) memchr (begin, separator, end - begin);
+		if (!next) next = end;
+		if (!add (CmdParamView (begin, next - begin))) {
+			_count = 0;
+			return false;
+		}
+		if (next == end) return true;
+		begin = next + 1;
+	}
+}
+
+}
@@ -0,0 +1,101 @@
+//************************************************************************************************************************
+// CmdParamView.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include <Print.h>
+
+
+#define CMD_PARAMS_LINE_LEN				64						// Params of one command
+#define CMD_MAX_PARAMS					10
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Non-owning view on one param of a command (slice of the line buffer of the parser, not terminated by 0) : the typed
+// accessors parse in place, without copy nor allocation. The view is valid until the parser reads the next command.
+class CmdParamView
+{
+private:
+	const char *	_data				= "";
+	size_t			_len				= 0;
+
+public:
+	CmdParamView						() {}
+	CmdParamView						(const char * data, size_t len) : _data (data), _len (len) {}
+
+	const char * data					() const				{	return _data;										}
+	size_t length						() const				{	return _len;										}
+	bool isEmpty						() const				{	return _len == 0;									}
+	char operator []					(size_t i) const		{	return (i < _len) ? _data [i] : 0;					}
+
+	bool equals							(const char * str) const;
+	bool equals							(const __FlashStringHelper * str) const;
+
+	// Return false (value unchanged) if the param is not entirely a value of this type (overflow included)
+	bool parseInt						(long & value) const;	// Decimal or 0x hexadecimal
+	bool parseFloat						(float & value) const;
+	bool parseBool						(bool & value) const;	// 1/0 true/false on/off yes/no
+	bool parseSeqTag					(uint16_t & seq) const;	// Sequence tag of a pipelined command : "#12" => 12
+
+	long toInt							(long defaultValue = 0) const			{	parseInt (defaultValue); return defaultValue;		}
+	float toFloat						(float defaultValue = 0) const			{	parseFloat (defaultValue); return defaultValue;	}
+	bool toBool							(bool defaultValue = false) const		{	parseBool (defaultValue); return defaultValue;		}
+
+	// "0A1bFF" => { 0x0A, 0x1B, 0xFF }, return the number of bytes (0 if the param is not hexadecimal)
+	size_t toHexBytes					(uint8_t * bytes, size_t maxBytes) const;
+
+	size_t printTo						(Print & printer) const	{	return printer.write ((const uint8_t *) _data, _len);	}
+};
+
+//------------------------------------------------------------------------------
+// Params of one command
+class CmdParamList
+{
+private:
+	CmdParamView	_params [CMD_MAX_PARAMS];
+	uint8_t			_count				= 0;
+
+public:
+	// Split the line on the separator (the line is not modified). Return false (empty list) if there are more than
+	// CMD_MAX_PARAMS params
+	bool split							(const char * line, size_t len, char separator);
+	void clear							()						{	_count = 0;											}
+	bool add							(const CmdParamView & param)
+																{	if (_count >= CMD_MAX_PARAMS) return false;
+																	_params [_count++] = param; return true;			}
+
+	uint8_t size						() const				{	return _count;										}
+	// Empty view if there is no such param
+	CmdParamView operator []			(uint8_t i) const		{	return (i < _count) ? _params [i] : CmdParamView ();	}
+	// The params from the index first (ex: without the sequence tag)
+	CmdParamList from					(uint8_t first) const	{	CmdParamList list;
+																	for (uint8_t i = first; i < _count; i++) list.add (_params [i]);
+																	return list;										}
+};
+
+//------------------------------------------------------------------------------
+// Line buffer of the params of one command with their views : owned by the callers of StreamCmdParser::getCmdParams
+// and StreamRespParser::getRespParams, the other parsers don't pay for it
+class CmdParamLine : public CmdParamList
+{
+private:
+	char			_line [CMD_PARAMS_LINE_LEN];
+
+public:
+	char * buffer						()						{	return _line;										}
+	static constexpr size_t capacity	()						{	return CMD_PARAMS_LINE_LEN;							}
+	bool splitLine						(size_t len, char separator)
+																{	return split (_line, len, separator);				}
+};
+
+//------------------------------------------------------------------------------
+// Streaming
+inline Print & operator << (Print & printer, const CmdParamView & param) { param.printTo (printer); return printer; }
+
+}
@@ -0,0 +1,129 @@
+//************************************************************************************************************************
+// CommandRouter.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Print/Logger.h"
+
+#include "CommandRouter.h"
+
+
+namespace corex {
+
+//========================================================================================================================
+// Linear probing from the slot of the id
+//========================================================================================================================
+bool CommandRouterBase :: add (uint16_t id, CmdRoute::invoke_t invoke)
+{
+	if (_count >= capacity ()) {
+		LogW (F("CommandRouter full, command ") << id << F(" ignored"));
+		return false;
+	}
+
+	for (size_t i = slot (id);; i = (i + 1) & (_size - 1)) {
+		CmdRoute & route = _routes [i];
+		if (route.invoke == nullptr) {
+			route = CmdRoute ();
+			route.id = id;
+			route.invoke = invoke;
+			_count++;
+			return true;
+		}
+		if (route.id == id) {
+			LogW (F("CommandRouter : command ") << id << F(" already routed"));
+			return false;
+		}
+	}
+}
+
+//========================================================================================================================
+// The table is never full => a free entry ends the search
+//========================================================================================================================
+CmdRoute * CommandRouterBase :: find (uint16_t id) const
+{
+	for (size_t i = slot (id);; i = (i + 1) & (_size - 1)) {
+		CmdRoute & route = _routes [i];
+		if (route.invoke == nullptr) return nullptr;
+		if (route.id == id) return &route;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+CommandRouterBase::Result CommandRouterBase :: dispatch (int id, const CmdParamList & params, Print & printer)
+{
+	if ((id < 0) || (id > 0xFFFF)) {
+		_unknown++;
+		return Result::UnknownId;
+	}
+
+	uint16_t seq;
+	bool tagged = (params.size () > 0) && params [0].parseSeqTag (seq);
+	CmdReply reply { printer, (uint16_t) id, tagged ? (int32_t) seq : -1 };
+
+	CmdRoute * route = find ((uint16_t) id);
+	if (route == nullptr) {
+		_unknown++;
+		if (tagged) reply.nack ();							// The client does not wait for its timeout
+		return Result::UnknownId;
+	}
+
+	uint32_t start = micros ();
+	bool done = tagged ? route->invoke (params.from (1), reply) : route->invoke (params, reply);
+	uint32_t elapsed = micros () - start;
+
+	route->calls++;
+	route->totalUs += elapsed;
+	if (elapsed > route->maxUs) route->maxUs = elapsed;
+	if (!done) route->errors++;
+
+	if (tagged && !reply.replied) {
+		if (done) reply.ack ();
+		else reply.nack ();
+	}
+
+	return done ? Result::Ok : Result::Failed;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+FunctionId CommandRouterBase :: attach (CmdFrameDecoder & decoder, Print & printer)
+{
+	return decoder.notifyCommand.push_back ("CommandRouter", [this, &printer] (int id, const CmdParamList & params) {
+		dispatch (id, params, printer);
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CommandRouterBase :: printStats (Print & printer) const
+{
+	printer << F("Commands routed: ") << _count << F(", unknown ids: ") << _unknown << LN;
+	for (size_t i = 0; i < _size; i++) {
+		const CmdRoute & route = _routes [i];
+		if ((route.invoke == nullptr) || (route.calls == 0)) continue;
+		printer << F("  [") << route.id << F("] calls: ") << route.calls << F(", errors: ") << route.errors
+				<< F(", avg: ") << (route.totalUs / route.calls) << F("us, max: ") << route.maxUs << F("us") << LN;
+	}
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void CommandRouterBase :: resetStats ()
+{
+	_unknown = 0;
+	for (size_t i = 0; i < _size; i++) {
+		CmdRoute & route = _routes [i];
+		route.calls = 0;
+		route.errors = 0;
+		route.totalUs = 0;
+		route.maxUs = 0;
+	}
+}
+
+}
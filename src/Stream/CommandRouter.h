@@ -0,0 +1,252 @@
+//************************************************************************************************************************
+// CommandRouter.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Print.h>
+
+#include <tuple>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+#include "Print/LinePrinter.h"
+
+#include "StreamCmdParser.h"
+#include "CmdParamView.h"
+#include "CmdFrameDecoder.h"
+
+
+#define CMD_ROUTER_DEFAULT_ROUTES		48						// Default capacity of a CommandRouter
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Conversion of one param in an argument of a handler, a handler can use the types of the specializations.
+// A value out of the range of the type fails (no silent truncation).
+template <typename T, typename Enable = void>
+struct CmdArg;
+
+template <typename T>
+struct CmdArg <T, typename std::enable_if <std::is_integral <T>::value && !std::is_same <T, bool>::value>::type>
+{
+	static bool parse (const CmdParamView & param, T & value)
+															{	long number;
+																if (!param.parseInt (number)) return false;
+																if (std::is_unsigned <T>::value) {
+																	if ((number < 0) || ((unsigned long) number > (unsigned long) std::numeric_limits <T>::max ())) return false;
+																}
+																else if ((number < (long) std::numeric_limits <T>::min ()) || (number > (long) std::numeric_limits <T>::max ())) return false;
+																value = (T) number;
+																return true;										}
+};
+
+template <typename T>
+struct CmdArg <T, typename std::enable_if <std::is_floating_point <T>::value>::type>
+{
+	static bool parse (const CmdParamView & param, T & value)
+															{	float number;
+																if (!param.parseFloat (number)) return false;
+																value = (T) number;
+																return true;										}
+};
+
+template <>
+struct CmdArg <bool>
+{
+	static bool parse (const CmdParamView & param, bool & value)	{	return param.parseBool (value);				}
+};
+
+template <>
+struct CmdArg <CmdParamView>
+{
+	static bool parse (const CmdParamView & param, CmdParamView & value)	{	value = param; return true;			}
+};
+
+//------------------------------------------------------------------------------
+// Storage of one argument during the decoding : a const CmdParamList & argument receives all the params (it does not
+// consume a param)
+template <typename T>
+struct CmdArgSlot
+{
+	using type = T;
+	static constexpr size_t consumed = 1;
+
+	static bool load (const CmdParamList & params, size_t i, type & value)	{	return CmdArg <T>::parse (params [i], value);	}
+	static T & get (type & value)											{	return value;									}
+};
+
+template <>
+struct CmdArgSlot <CmdParamList>
+{
+	using type = const CmdParamList *;
+	static constexpr size_t consumed = 0;
+
+	static bool load (const CmdParamList & params, size_t, type & value)	{	value = &params; return true;					}
+	static const CmdParamList & get (type & value)							{	return *value;									}
+};
+
+//------------------------------------------------------------------------------
+// Reply to the command being dispatched : repeats its sequence tag when the command has one (pipelined by a
+// CmdCorrelator) => "<< [id:#seq|value]", otherwise "<< [id:value]"
+struct CmdReply
+{
+	Print &			printer;
+	uint16_t		id;
+	int32_t			seq;									// -1 => command without sequence tag
+	bool			replied				= false;
+
+	template <typename T>
+	void send						(const T & value)		{	if (seq >= 0) printer << PRINT_RESP_T (id, seq, value) << LN;
+																else printer << PRINT_RESP (id, value) << LN;
+																replied = true;										}
+	void ack						()						{	send (F(MSG_ACK));									}
+	void nack						()						{	send (F(MSG_NACK));									}
+};
+
+//------------------------------------------------------------------------------
+// Handler : function given as template parameter, its arguments are decoded from the params of the command (in the
+// same order). The first argument can be a CmdReply & or a Print & (the printer of the dispatch, to reply), the last one
+// can be a const CmdParamList & (all the params, ex: for a variable number of params). A handler which returns false
+// fails.
+//
+template <typename Fn>
+struct CmdHandlerTraits;
+
+template <typename R, typename ...Args>
+struct CmdHandlerTraits <R (*) (Args...)>
+{
+	template <typename Fn, typename ...Values>
+	static bool invoke (Fn fn, Values && ...values)			{	if constexpr (std::is_same <R, bool>::value) return fn (values...);
+																else { fn (values...); return true; }				}
+
+	// Lead : the arguments given before the decoded ones (the printer)
+	template <auto Handler, size_t ...I, typename ...Lead>
+	static bool decode (const CmdParamList & params, std::index_sequence <I...>, Lead & ...lead)
+															{	if (params.size () < (CmdArgSlot <typename std::decay <Args>::type>::consumed + ... + 0)) return false;
+																std::tuple <typename CmdArgSlot <typename std::decay <Args>::type>::type...> values;
+																if (!(CmdArgSlot <typename std::decay <Args>::type>::load (params, I, std::get <I> (values)) && ...)) return false;
+																return invoke (Handler, lead..., CmdArgSlot <typename std::decay <Args>::type>::get (std::get <I> (values))...);	}
+
+	template <auto Handler>
+	static bool call (const CmdParamList & params, CmdReply &)
+															{	return decode <Handler> (params, std::index_sequence_for <Args...> ());	}
+};
+
+template <typename R, typename ...Args>
+struct CmdHandlerTraits <R (*) (Print &, Args...)>
+{
+	template <auto Handler>
+	static bool call (const CmdParamList & params, CmdReply & reply)
+															{	return CmdHandlerTraits <R (*) (Args...)>::template decode <Handler> (params, std::index_sequence_for <Args...> (), reply.printer);	}
+};
+
+template <typename R, typename ...Args>
+struct CmdHandlerTraits <R (*) (CmdReply &, Args...)>
+{
+	template <auto Handler>
+	static bool call (const CmdParamList & params, CmdReply & reply)
+															{	return CmdHandlerTraits <R (*) (Args...)>::template decode <Handler> (params, std::index_sequence_for <Args...> (), reply);	}
+};
+
+//------------------------------------------------------------------------------
+// Route of one command id, with its counters
+struct CmdRoute
+{
+	using invoke_t = bool (*) (const CmdParamList & params, CmdReply & reply);
+
+	invoke_t		invoke				= nullptr;			// null => free entry
+	uint16_t		id					= 0;
+	uint32_t		calls				= 0;
+	uint32_t		errors				= 0;
+	uint32_t		totalUs				= 0;
+	uint32_t		maxUs				= 0;
+};
+
+//------------------------------------------------------------------------------
+// Dispatch of the commands (16 bits ids) to their handlers : open addressing table of fixed size (no heap, no chain of
+// if), the cost of a dispatch does not depend on the number of commands.
+// The same router can serve several streams and framings (attach to a CmdFrameDecoder, or dispatch the id and the
+// params read by a StreamCmdParser).
+// A command with a sequence tag (first param "#seq", sent by a CmdCorrelator) is dispatched without the tag and always
+// gets a tagged response : the one sent by the handler with its CmdReply, or else OK / KO (also for an unknown id).
+// The table is given by the caller (see CommandRouter), its size is a power of 2 filled at 3/4 max.
+//
+class CommandRouterBase
+{
+public:
+	enum class Result : uint8_t { Ok, UnknownId, Failed };
+
+private:
+
+	CmdRoute *		_routes;
+	uint32_t		_size;									// Power of 2
+	uint8_t			_bits;									// log2 (_size)
+	uint16_t		_count				= 0;
+	uint32_t		_unknown			= 0;
+
+	inline size_t slot				(uint16_t id) const		{	return (uint32_t) (id * 2654435769u) >> (32 - _bits);	}
+
+	bool add						(uint16_t id, CmdRoute::invoke_t invoke);
+	CmdRoute * find					(uint16_t id) const;
+
+protected:
+
+	CommandRouterBase				(CmdRoute * routes, uint8_t bits) : _routes (routes), _size (1 << bits), _bits (bits) {}
+
+public:
+
+	// Return false if the id already has a handler or the table is full
+	template <auto Handler>
+	bool on							(uint16_t id)			{	return add (id, &CmdHandlerTraits <decltype (Handler)>::template call <Handler>);		}
+
+	Result dispatch					(int id, const CmdParamList & params, Print & printer);
+
+	// Dispatch all the commands completed by the decoder (the result is only counted)
+	FunctionId attach				(CmdFrameDecoder & decoder, Print & printer);
+
+	uint16_t size					() const				{	return _count;										}
+	size_t capacity					() const				{	return _size * 3 / 4;								}
+	uint32_t unknown				() const				{	return _unknown;									}
+	const CmdRoute * route			(uint16_t id) const		{	return find (id);									}
+
+	void printStats					(Print & printer) const;
+	void resetStats					();
+};
+
+//------------------------------------------------------------------------------
+// CommandRouter with its own table, for at least MaxRoutes commands
+//
+// Example :
+//		void setLed (uint8_t pin, bool on) { digitalWrite (pin, on); }
+//		void readTemp (CmdReply & reply) { reply.send (sensor.read ()); }
+//
+//		CommandRouter <300> router;
+//		router.on <setLed> (12);
+//		router.on <readTemp> (20);
+//		router.attach (parser, client);
+//
+template <size_t MaxRoutes = CMD_ROUTER_DEFAULT_ROUTES>
+class CommandRouter : public CommandRouterBase
+{
+	static_assert ((MaxRoutes > 0) && (MaxRoutes <= 0xC000), "1 to 49152 routes (16 bits ids)");
+
+	// Smallest power of 2 filled at 3/4 max
+	static constexpr uint8_t bits	()						{	uint8_t b = 1;
+																while (((size_t) 1 << b) * 3 / 4 < MaxRoutes) b++;
+																return b;											}
+
+	CmdRoute		_table [1 << bits ()];
+
+public:
+	CommandRouter					() : CommandRouterBase (_table, bits ()) {}
+
+	CommandRouter					(const CommandRouter &) = delete;
+	CommandRouter & operator =		(const CommandRouter &) = delete;
+};
+
+}
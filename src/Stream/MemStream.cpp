@@ -69,7 +69,7 @@ size_t MemStream::write (uint8_t byte) {
 
 			// Copy the buffer values in the file
 			if (_fileStream->write (_buffer, BUF_MAX_LEN) != BUF_MAX_LEN) {
-				Logln(F("Cannot copy the values of the memory stream in the temporary file :("));
+				LogE(F("Cannot copy the values of the memory stream in the temporary file :("));
 				return -1;
 			}
 			_pos_read = 0;
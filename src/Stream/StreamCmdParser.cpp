@@ -61,45 +61,84 @@ bool StreamCmdParser :: checkSeparatorParam (Stream & stream) {
 int StreamCmdParser :: getCmdId (Stream & stream) {
 	// read the command Id
 	int commandId = stream.parseInt();
-	if ((commandId < 0) || (10 < commandId)) {
-		Logln (F("commandId < 0 or > 10 ???"));
+	if ((commandId < 0) || (0xFFFF < commandId)) {
+		LogW (F("commandId < 0 or > 0xFFFF ???"));
 		return -1;
 	}
 	return commandId;
 }
 
+//========================================================================================================================
+// Read the available chars until one of the stop chars (not read), return the number of chars read
+//========================================================================================================================
+static size_t readUntil (Stream & stream, const char * stops, char * buffer, size_t size) {
+
+	size_t len = 0;
+	int p = stream.peek ();
+
+	while ((p >= 0) && (len < size) && !(p && strchr (stops, p))) {
+		buffer [len++] = (char) stream.read ();
+		p = stream.peek ();
+	}
+	return len;
+}
+
+//========================================================================================================================
+// Read the params in the line, or skip them until one of the stop chars (not read) when they are too long or too many
+//========================================================================================================================
+static bool readParams (Stream & stream, const char * stops, CmdParamLine & params) {
+
+	size_t len = readUntil (stream, stops, params.buffer (), params.capacity ());
+
+	int p = stream.peek ();
+	if ((len == params.capacity ()) && (p >= 0) && !(p && strchr (stops, p))) {
+
+		while ((p >= 0) && !(p && strchr (stops, p))) {
+			stream.read ();
+			p = stream.peek ();
+		}
+		LogW (F("params longer than ") << params.capacity () << F(" chars, skipped"));
+		params.clear ();
+		return false;
+	}
+
+	if (!params.splitLine (len, MSG_SEPARATOR_PARAM [0])) {
+		LogW (F("more than ") << CMD_MAX_PARAMS << F(" params"));
+		return false;
+	}
+	return true;
+}
+
 //========================================================================================================================
 //
 //========================================================================================================================
 String StreamCmdParser :: getCmdParam (Stream & stream) {
 
+	static const char stops [] = { MSG_SEPARATOR_PARAM [0], MSG_SEPARATOR_CMD [0], MSG_TAG_END [0], 0 };
+
 	String ret;
-	int p = stream.peek();
-
-	while (p >= 0) {
-		String checkStr;
-		int i = 1;
-
-		// Le prochain separateur est il MSG_SEPARATOR_PARAM, MSG_SEPARATOR_CMD ou MSG_TAG_END ?
-		if (p == MSG_SEPARATOR_PARAM[0]) checkStr = MSG_SEPARATOR_PARAM;
-		if (p == MSG_SEPARATOR_CMD[0]) checkStr = MSG_SEPARATOR_CMD;
-		if (p == MSG_TAG_END[0]) checkStr = MSG_TAG_END;
-
-		if (checkStr.length() > 0) {
-			for (i = 1; i<checkStr.length(); i++) {
-				p = stream.peek ();
-				if (p != checkStr[i]) break;
-			}
-			if (i == checkStr.length()) return ret;
-		}
+	char block [CMD_PARAMS_LINE_LEN];
 
-		ret += (char)stream.read();
-		p = stream.peek();
-	}
+	// By blocks (not char by char)
+	size_t len;
+	do {
+		len = readUntil (stream, stops, block, sizeof (block));
+		ret.concat (block, len);
+	} while (len == sizeof (block));
 
 	return ret;
 }
 
+//========================================================================================================================
+// The params until the end of the command (the separator of the commands or the end of the frame is not read)
+//========================================================================================================================
+bool StreamCmdParser :: getCmdParams (Stream & stream, CmdParamLine & params) {
+
+	static const char stops [] = { MSG_SEPARATOR_CMD [0], MSG_TAG_END [0], 0 };
+
+	return readParams (stream, stops, params);
+}
+
 
 
 
@@ -154,8 +193,8 @@ bool StreamRespParser :: checkSeparatorParam (Stream & stream) {
 int StreamRespParser :: getRespId (Stream & stream) {
 	// read the command Id
 	int respId = stream.parseInt();
-	if ((respId < 0) || (10 < respId)) {
-		Logln (F("respId < 0 or > 10 ???"));
+	if ((respId < 0) || (0xFFFF < respId)) {
+		LogW (F("respId < 0 or > 0xFFFF ???"));
 		return -1;
 	}
 	return respId;
@@ -166,30 +205,29 @@ int StreamRespParser :: getRespId (Stream & stream) {
 //========================================================================================================================
 String StreamRespParser :: getRespParam (Stream & stream) {
 
+	static const char stops [] = { MSG_SEPARATOR_PARAM [0], MSG_TAG_END [0], 0 };
+
 	String ret;
-	int p = stream.peek();
-
-	while (p >= 0) {
-		String checkStr;
-		int i = 1;
-
-		// Le prochain separateur est il MSG_SEPARATOR_PARAM ou MSG_TAG_END ?
-		if (p == MSG_SEPARATOR_PARAM[0]) checkStr = MSG_SEPARATOR_PARAM;
-		if (p == MSG_TAG_END[0]) checkStr = MSG_TAG_END;
-
-		if (checkStr.length() > 0) {
-			for (i = 1; i<checkStr.length(); i++) {
-				p = stream.peek ();
-				if (p != checkStr[i]) break;
-			}
-			if (i == checkStr.length()) return ret;
-		}
+	char block [CMD_PARAMS_LINE_LEN];
 
-		ret += (char)stream.read();
-		p = stream.peek();
-	}
+	// By blocks (not char by char)
+	size_t len;
+	do {
+		len = readUntil (stream, stops, block, sizeof (block));
+		ret.concat (block, len);
+	} while (len == sizeof (block));
 
 	return ret;
 }
 
+//========================================================================================================================
+// The params until the end of the response (the end of the frame is not read)
+//========================================================================================================================
+bool StreamRespParser :: getRespParams (Stream & stream, CmdParamLine & params) {
+
+	static const char stops [] = { MSG_TAG_END [0], 0 };
+
+	return readParams (stream, stops, params);
+}
+
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 
 #include "StreamParser.h"
+#include "CmdParamView.h"
 
 
 #define CMD_START					">> "
@@ -19,6 +20,7 @@
 #define MSG_SEPARATOR_CMD_PARAM		"/"
 #define MSG_SEPARATOR_RESP_PARAM	":"
 #define MSG_SEPARATOR_PARAM			"|"
+#define MSG_SEQ_TAG					"#"						// Sequence tag of a pipelined command, first param : [id/#seq|...]
 
 #define MSG_ACK						" OK"
 #define MSG_NACK					" KO"
@@ -28,9 +30,17 @@
 #define PRINT_CMD_P(id,p)			F(CMD_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_CMD_PARAM) << p << F(MSG_TAG_END)
 #define PRINT_RESP(id,p)			F(RESP_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_RESP_PARAM) << p << F(MSG_TAG_END)
 
+// Tagged versions (the response repeats the sequence tag of the command, see CmdCorrelator)
+#define PRINT_CMD_T(id,seq)			F(CMD_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_CMD_PARAM) << F(MSG_SEQ_TAG) << seq << F(MSG_TAG_END)
+#define PRINT_CMD_TP(id,seq,p)		F(CMD_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_CMD_PARAM) << F(MSG_SEQ_TAG) << seq << F(MSG_SEPARATOR_PARAM) << p << F(MSG_TAG_END)
+#define PRINT_RESP_T(id,seq,p)		F(RESP_START) << F(MSG_TAG_BEGIN) << id << F(MSG_SEPARATOR_RESP_PARAM) << F(MSG_SEQ_TAG) << seq << F(MSG_SEPARATOR_PARAM) << p << F(MSG_TAG_END)
+
 #define PRINT_ACK(id)				PRINT_RESP(id,F(MSG_ACK))
 #define PRINT_NACK(id)				PRINT_RESP(id,F(MSG_NACK))
 #define PRINT_ERROR(id)				PRINT_RESP(id,F(MSG_ERROR))
+#define PRINT_ACK_T(id,seq)			PRINT_RESP_T(id,seq,F(MSG_ACK))
+#define PRINT_NACK_T(id,seq)		PRINT_RESP_T(id,seq,F(MSG_NACK))
+#define PRINT_ERROR_T(id,seq)		PRINT_RESP_T(id,seq,F(MSG_ERROR))
 #define PRINT_PARSE_FAILS(id)		F("ERROR: Invalid message or format") << LN << PRINT_ERROR(id)
 
 
@@ -49,6 +59,9 @@ protected:
 	bool checkSeparatorParam		(Stream & stream);
 	int getCmdId					(Stream & stream);
 	String getCmdParam				(Stream & stream);
+	// All the params of the command read at once in the line of the caller (views valid until its next use). Return
+	// false (empty list, params skipped until the end of the command) if they don't fit in the line or in the list
+	bool getCmdParams				(Stream & stream, CmdParamLine & params);
 };
 
 //------------------------------------------------------------------------------
@@ -63,6 +76,9 @@ protected:
 	bool checkSeparatorParam		(Stream & stream);
 	int getRespId					(Stream & stream);
 	String getRespParam				(Stream & stream);
+	// All the params of the response read at once in the line of the caller (views valid until its next use). Return
+	// false (empty list, params skipped until the end of the response) if they don't fit in the line or in the list
+	bool getRespParams				(Stream & stream, CmdParamLine & params);
 };
 
 }
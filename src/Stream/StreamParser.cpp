@@ -5,6 +5,7 @@
 //************************************************************************************************************************
 
 #include "Print/Logger.h"
+#include "Print/Format.h"
 
 #include "StreamParser.h"
 
@@ -47,10 +48,7 @@ uint8_t StreamParser :: hexstr2Int (Stream & stream) {
 
 	stream.readBytes (hexValue, 2);
 
-	uint8_t tens = (hexValue[0] <= '9') ? hexValue[0] - '0' : hexValue[0] - '7';
-	uint8_t ones = (hexValue[1] <= '9') ? hexValue[1] - '0' : hexValue[1] - '7';
-
-	return (16 * tens) + ones;
+	return (fmt::hexValue (hexValue[0]) << 4) | fmt::hexValue (hexValue[1]);
 }
 
 }
\ No newline at end of file
@@ -8,19 +8,29 @@
 
 // https://techtutorialsx.com/2016/12/11/esp8266-external-interrupts/
 
-#include <FunctionalInterrupt.h>
+#include <Arduino.h>
 
 #include "Common.h"
 #include "Module/AsyncModule.h"
+#include "Tools/DeferredSignal.h"
+
+
+// Number of presses which can be recorded by the ISR between two loops of the ModuleSequencer
+#define ASYNC_PUSH_BUTTON_EVENTS		4
 
 
 namespace corex {
 
+//------------------------------------------------------------------------------
+// WARNING : the presses are only notified if the ModuleSequencer is set up and looped (it drains notifyPressedState),
+// otherwise call notifyPressedState.drain () in the loop of the sketch
+//
 class AsyncPushButton : public AsyncModule <uint8_t>
 {
 public:
 
-	AsyncPushButton (uint8_t pin) { setup (pin); }
+	AsyncPushButton (uint8_t pin) { setup (pin); I(ModuleSequencer).addDeferred (&notifyPressedState); }
+	~AsyncPushButton () { I(ModuleSequencer).removeDeferred (&notifyPressedState); }
 
 	/* Interrupts may be attached in all the GPIOs of the ESP8266, except for the GPIO16 [3]											*/
 	virtual void setup (uint8_t pin) override
@@ -38,12 +48,17 @@ public:
 		/* Attention ne pas utiliser le mode INPUT_PULLUP avec un pin déjà connecté avec une LED et une résistance ! 					*/
 		pinMode (pin, ((pin == USER_BTN) || (pin == BLINKLED)) ? INPUT : INPUT_PULLUP);
 
-		/* to trigger when the pin goes from high to low */
-		attachInterrupt (digitalPinToInterrupt(pin), [this]() {	notifyPressedState(); }, FALLING);
+		/* to trigger when the pin goes from high to low : the ISR only records the event, the subscribers are notified		*/
+		/* later by the ModuleSequencer loop (or by an explicit call to notifyPressedState.drain ())							*/
+		attachInterruptArg (digitalPinToInterrupt(pin), &onFalling, this, FALLING);
 	}
 
+private:
+	/* ISR in IRAM : no std::function, no capture										*/
+	static void IRAM_ATTR onFalling (void * button) { static_cast <AsyncPushButton *> (button)->notifyPressedState.post (); }
+
 public:
-	Signal <> notifyPressedState;		// WARNµING : You can not use yield or delay or any function that uses them inside the ISR callbacks
+	DeferredSignal <ASYNC_PUSH_BUTTON_EVENTS> notifyPressedState;		// The subscribers are called in task context, not inside the ISR
 
 };
 
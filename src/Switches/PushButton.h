@@ -20,7 +20,8 @@ class PushButton : public Module <uint8_t>
 {
 public:
 
-	PushButton (uint8_t pin) { setup (pin); }
+	PushButton (uint8_t pin) { setup (pin); I(ModuleSequencer).addDeferred (&notifyPressedState); }
+	~PushButton () { I(ModuleSequencer).removeDeferred (&notifyPressedState); }
 
 	/* Interrupts may be attached in all the GPIOs of the ESP8266, except for the GPIO16 [3]											*/
 	virtual void setup (uint8_t pin) override
@@ -50,13 +51,13 @@ public:
 	void loop () override
 	{
 		if (_pressedState) {
-			notifyPressedState ();
 			_pressedState = false;
+			notifyPressedState ();			// Recorded, the subscribers are notified once by the next loop of the ModuleSequencer
 		}
 	}
 
 public:
-	Signal <> notifyPressedState;
+	CoalescingSignal <> notifyPressedState;
 
 protected:
 	/* We need to declare a variable as volatile when it can be changed unexpectedly (as in an ISR), so the compiler doesn’t remove		*/
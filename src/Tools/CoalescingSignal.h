@@ -0,0 +1,72 @@
+//************************************************************************************************************************
+// CoalescingSignal.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <tuple>
+#include <type_traits>
+
+#include "Signal.h"
+#include "DeferredSignal.h"
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Signal which merges a burst of emissions in only one delivery : notify () just records the last arguments and counts
+// the emissions, drain () (ModuleSequencer loop) notifies the subscribers once with the last arguments when the window
+// (in millis, 0 => at each drain) since the first emission of the burst is elapsed.
+// The subscribers are unchanged, they can get the number of merged emissions with occurrences ().
+// The Signal is a protected base (as in WiredSignal) : a CoalescingSignal can't be passed as a Signal & (its notify would
+// deliver at once), only the API to add and remove the slots is exposed.
+//
+template <typename ...Args>
+class CoalescingSignal : protected Signal <Args...>, public IDeferred
+{
+private:
+	using Runtime = Signal <Args...>;
+
+protected:
+	using args_t = std::tuple <typename std::decay <Args>::type...>;
+
+	args_t						_lastArgs;
+	uint32_t					_count				= 0;		// Emissions since the last delivery
+	uint32_t					_occurrences		= 0;		// Emissions merged in the last delivery
+	unsigned long				_windowMs			= 0;
+	unsigned long				_firstEmissionMs	= 0;
+
+public:
+	using typename Runtime::fn_t;
+	using Runtime::push_back;
+	using Runtime::remove;
+	using Runtime::clear;
+	using Runtime::operator bool;
+
+	CoalescingSignal			(unsigned long windowMs = 0) : _windowMs (windowMs) {}
+
+	CoalescingSignal& operator = (fn_t fn)					{	Runtime::operator= (fn); return *this;						}
+	FunctionId operator+=		(fn_t fn)					{	return Runtime::push_back (fn);								}
+	CoalescingSignal& operator-=(FunctionId id)				{	Runtime::remove (id); return *this;							}
+
+	void setWindow				(unsigned long windowMs)	{	_windowMs = windowMs;										}
+	bool isPending				() const					{	return _count != 0;											}
+	uint32_t occurrences		() const					{	return _occurrences;										}
+
+	void operator()				(Args ...args)				{	notify (args...);											}
+	inline void notify			(Args ...args)				{	_lastArgs = args_t (args...);
+																if (_count++ == 0) _firstEmissionMs = millis ();		}
+
+	virtual void drain			() override					{	if (!_count) return;
+																if (millis () - _firstEmissionMs < _windowMs) return;
+																args_t args = _lastArgs;
+																_occurrences = _count;
+																_count = 0;
+																std::apply ([this] (auto & ...a) { this->Runtime::notify (a...); }, args);	}
+};
+
+}
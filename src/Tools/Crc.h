@@ -0,0 +1,30 @@
+//************************************************************************************************************************
+// Crc.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), without table to save the flash
+// The crc of a previous block can be given to continue the computation
+inline uint16_t crc16 (const void * data, size_t len, uint16_t crc = 0xFFFF)
+{
+	const uint8_t * p = (const uint8_t *) data;
+	while (len--) {
+		crc ^= (uint16_t) (*p++) << 8;
+		for (uint8_t i = 0; i < 8; i++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+}
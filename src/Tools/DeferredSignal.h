@@ -0,0 +1,112 @@
+//************************************************************************************************************************
+// DeferredSignal.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <tuple>
+#include <type_traits>
+
+#include "Signal.h"
+
+#ifdef ESP32
+#	include <esp_idf_version.h>
+#	if ESP_IDF_VERSION_MAJOR >= 5
+#		include <esp_cpu.h>
+#	else
+#		include <hal/cpu_hal.h>
+#	endif
+#endif
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Cycle counter readable from an ISR in IRAM (ESP.getCycleCount is not in IRAM on ESP32)
+__attribute__((always_inline)) static inline uint32_t isrCycleCount ()
+{
+#if defined (ESP32) && (ESP_IDF_VERSION_MAJOR >= 5)
+	return (uint32_t) esp_cpu_get_cycle_count ();
+#elif defined (ESP32)
+	return (uint32_t) cpu_hal_get_cycle_count ();
+#else
+	return ESP.getCycleCount ();						// Inline "rsr ccount" on ESP8266
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Something which delivers later, in task context, what was recorded before (ex: from an ISR)
+class IDeferred
+{
+public:
+	virtual ~IDeferred() = default;
+	virtual void drain () = 0;
+};
+
+//------------------------------------------------------------------------------
+// Signal whose emission is split in two parts :
+// - post () is called from the ISR, it only copies the arguments in a wait-free single producer ring (no heap, no slot call)
+// - drain () is called from the task context (ModuleSequencer::loop or explicitly) and notifies the subscribers
+// => the subscribers can use yield, delay, Log...
+//
+// N is the depth of the ring (power of 2), the arguments must be trivially copyable (they are copied in the ring).
+// When the ring is full the event is lost but counted (overflows).
+// post () is in IRAM and only calls inlined code => it can be called by an ISR while the flash cache is disabled.
+//
+template <size_t N, typename ...Args>
+class DeferredSignal : public Signal <Args...>, public IDeferred
+{
+	static_assert ((N >= 2) && ((N & (N - 1)) == 0), "The depth of the ring must be a power of 2");
+	static_assert ((std::is_trivially_copyable <typename std::decay <Args>::type>::value && ...), "The arguments must be trivially copyable");
+
+protected:
+	using event_t = std::tuple <typename std::decay <Args>::type...>;
+
+	event_t						_events [N];
+	volatile uint32_t			_head				= 0;		// Only written by the producer (ISR)
+	volatile uint32_t			_tail				= 0;		// Only written by the consumer (task)
+
+	volatile uint32_t			_overflows			= 0;
+	volatile uint32_t			_maxPostCycles		= 0;
+
+public:
+
+	// ISR side : must stay short, bounded and without any call to the subscribers
+	IRAM_ATTR bool post			(Args ...args)	{	uint32_t start = isrCycleCount ();
+													bool posted = false;
+													uint32_t head = _head;
+													if (head - _tail < N) {
+														_events [head & (N - 1)] = event_t (args...);
+														__sync_synchronize ();							// The event must be written before it is published
+														_head = head + 1;
+														posted = true;
+													}
+													else {
+														_overflows = _overflows + 1;
+													}
+													uint32_t cycles = isrCycleCount () - start;
+													if (cycles > _maxPostCycles) _maxPostCycles = cycles;
+													return posted;												}
+
+	void operator()				(Args ...args)	{	post (args...);												}
+
+	// Task side : deliver the events posted before the call (the ones posted during the delivery wait the next drain)
+	virtual void drain			() override		{	uint32_t head = _head;
+													__sync_synchronize ();
+													while (_tail != head) {
+														event_t event = _events [_tail & (N - 1)];
+														_tail = _tail + 1;
+														std::apply ([this] (auto & ...args) { this->notify (args...); }, event);
+													}															}
+
+	uint32_t pending			() const		{	return _head - _tail;										}
+	uint32_t overflows			() const		{	return _overflows;											}
+	uint32_t maxPostCycles		() const		{	return _maxPostCycles;										}
+	void resetStats				()				{	_overflows = 0; _maxPostCycles = 0;							}
+};
+
+}
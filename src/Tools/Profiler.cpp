@@ -0,0 +1,117 @@
+//************************************************************************************************************************
+// Profiler.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "Profiler.h"
+
+#ifdef CORE_PROFILING
+
+#ifdef ARDUINO
+#	include "Print/LinePrinter.h"
+#endif
+
+
+namespace corex {
+
+
+ProfileZone * Profiler :: _head = nullptr;
+
+
+//========================================================================================================================
+// Constructed at the first pass in the zone
+//========================================================================================================================
+ProfileZone :: ProfileZone (const char * name) :
+	name (name)
+{
+	next = Profiler::_head;
+	Profiler::_head = this;
+}
+
+//========================================================================================================================
+// The bucket of a duration is the number of bits of the duration
+//========================================================================================================================
+void ProfileZone :: record (uint32_t us)
+{
+	count++;
+	totalUs += us;
+	if (us < minUs) minUs = us;
+	if (us > maxUs) maxUs = us;
+
+	uint8_t bucket = (us > 1) ? (32 - __builtin_clz (us)) - 1 : 0;
+	if (bucket >= PROFILER_BUCKETS) bucket = PROFILER_BUCKETS - 1;
+	buckets [bucket]++;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void ProfileZone :: reset ()
+{
+	count	= 0;
+	minUs	= UINT32_MAX;
+	maxUs	= 0;
+	totalUs	= 0;
+	for (uint32_t & bucket : buckets) {
+		bucket = 0;
+	}
+}
+
+//========================================================================================================================
+// Estimate : upper bound of the bucket, limited by the max
+//========================================================================================================================
+uint32_t ProfileZone :: percentile (uint8_t percent) const
+{
+	if (count == 0) return 0;
+
+	uint32_t rank = ((uint64_t) count * percent + 99) / 100;			// Rank of the percentile (1..count)
+	uint32_t cumul = 0;
+
+	for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+		cumul += buckets [i];
+		if (cumul >= rank) {
+			uint32_t upper = (2u << i) - 1;
+			return (upper < maxUs) ? upper : maxUs;
+		}
+	}
+	return maxUs;
+}
+
+#ifdef ARDUINO
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void Profiler :: printZones (Print & printer)
+{
+	printer << F("Zone (count / min us / avg us / p50 us / p99 us / max us)") << LN;
+
+	for (const ProfileZone * zone = _head; zone; zone = zone->next) {
+		if (zone->count == 0) continue;
+
+		printer << zone->name << F(" (")
+				<< zone->count << F(" / ")
+				<< zone->minUs << F(" / ")
+				<< (uint32_t) (zone->totalUs / zone->count) << F(" / ")
+				<< zone->percentile (50) << F(" / ")
+				<< zone->percentile (99) << F(" / ")
+				<< zone->maxUs << F(")") << LN;
+	}
+}
+
+#endif
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void Profiler :: reset ()
+{
+	for (ProfileZone * zone = _head; zone; zone = zone->next) {
+		zone->reset ();
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,108 @@
+//************************************************************************************************************************
+// Profiler.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+// Define CORE_PROFILING (build flag) to measure the time spent in the zones declared by CORE_PROFILE_SCOPE.
+// Without CORE_PROFILING nothing is compiled and CORE_PROFILE_SCOPE costs nothing.
+// Without ARDUINO (host tests on Linux) the time is measured with std::chrono.
+
+#ifdef CORE_PROFILING
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#	include <Arduino.h>
+#	include <Print.h>
+#else
+#	include <chrono>
+#endif
+
+
+#define PROFILER_BUCKETS				24						// log2 buckets of us : [0,1] [2,3] [4,7] ... up to 2^23 us (~8s)
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Statistics of one zone (a static variable of the CORE_PROFILE_SCOPE macro => no heap)
+struct ProfileZone
+{
+	const char *	name;
+	uint32_t		count					= 0;
+	uint32_t		minUs					= UINT32_MAX;
+	uint32_t		maxUs					= 0;
+	uint64_t		totalUs					= 0;
+	uint32_t		buckets [PROFILER_BUCKETS] = {};
+
+	ProfileZone *	next					= nullptr;
+
+	ProfileZone		(const char * name);
+
+	void record		(uint32_t us);
+	void reset		();
+
+	// Upper bound of the bucket which contains the percentile (0 < percent <= 100)
+	uint32_t percentile	(uint8_t percent) const;
+};
+
+//------------------------------------------------------------------------------
+// Static Class : clock and list of all the zones
+//------------------------------------------------------------------------------
+class Profiler final
+{
+	friend struct ProfileZone;
+
+private:
+	static ProfileZone * _head;
+
+public:
+
+	~Profiler() = delete;	// you can not create an instance of such a class
+
+#ifdef ARDUINO
+	static inline uint32_t now			()		{	return micros ();															}
+#else
+	static inline uint32_t now			()		{	return (uint32_t) std::chrono::duration_cast <std::chrono::microseconds> (
+														std::chrono::steady_clock::now ().time_since_epoch ()).count ();		}
+#endif
+
+	static ProfileZone * first			()		{	return _head;																}
+
+#ifdef ARDUINO
+	static void printZones				(Print & printer);
+#endif
+	static void reset					();
+};
+
+//------------------------------------------------------------------------------
+// Measure the time between its construction and its destruction
+class ProfileScope
+{
+private:
+	ProfileZone &	_zone;
+	uint32_t		_start;
+
+public:
+	ProfileScope	(ProfileZone & zone) : _zone (zone), _start (Profiler::now ())	{}
+	~ProfileScope	()																{	_zone.record (Profiler::now () - _start);	}
+};
+
+}
+
+#define CORE_PROFILE_CONCAT_(a, b)			a##b
+#define CORE_PROFILE_CONCAT(a, b)			CORE_PROFILE_CONCAT_(a, b)
+
+// Profile the end of the current scope
+#define CORE_PROFILE_SCOPE(name)			static corex::ProfileZone CORE_PROFILE_CONCAT(_profileZone, __LINE__) (name);	\
+											corex::ProfileScope CORE_PROFILE_CONCAT(_profileScope, __LINE__) (CORE_PROFILE_CONCAT(_profileZone, __LINE__))
+
+#else
+
+#define CORE_PROFILE_SCOPE(name)
+
+#endif
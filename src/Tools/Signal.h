@@ -11,6 +11,11 @@
 #include <memory>
 #include <map>
 
+#ifdef SIGNAL_PROFILING
+#	include <Arduino.h>
+#	include "SignalProfiler.h"
+#endif
+
 
 namespace corex {
 
@@ -26,18 +31,57 @@ protected:
 	FunctionId 					_guid{ 0 };
 	std::map <FunctionId, fn_t> _delegates;
 
+#ifdef SIGNAL_PROFILING
+	std::map <FunctionId, SlotProfile *> _profiles;
+
+	void copyProfiles		(const Signal &d) 				{	clearProfiles();
+																for (auto & it : d._profiles) _profiles [it.first] = SignalProfiler::create (it.second->name);	}
+	void clearProfiles		() 								{	for (auto & it : _profiles) SignalProfiler::destroy (it.second);
+																_profiles.clear();												}
+#endif
+
 public:
 	Signal 					() 								{}
+#ifdef SIGNAL_PROFILING
+	Signal 					(const Signal &d) 				{	_delegates = d._delegates; _guid = d._guid; copyProfiles (d);	}
+	Signal& operator = 		(const Signal &d) 				{	_delegates = d._delegates; _guid = d._guid; copyProfiles (d);
+																return *this; 													}
+#else
 	Signal 					(const Signal &d) 				{	_delegates = d._delegates; 										}
 	Signal& operator = 		(const Signal &d) 				{	_delegates = d._delegates; return *this; 						}
+#endif
 	~Signal					()								{	clear();														}
 
 	void operator()			(Args ...args) 					{	notify(args...); 												}
 	operator bool() 										{	return _delegates.size() != 0; 									}
 	Signal& operator = 		(fn_t fn) 						{	clear(); push_back(fn); return *this; 							}
-	FunctionId push_back	(fn_t fn) 						{	_delegates.insert(std::make_pair(++_guid, fn)); return _guid;	}
+	FunctionId push_back	(fn_t fn) 						{	return push_back(nullptr, fn);									}
 	FunctionId operator+=	(fn_t fn) 						{	return push_back(fn); 											}
 	Signal& operator-=		(FunctionId id) 				{	remove(id); return *this;		 								}
+
+#ifdef SIGNAL_PROFILING
+	// The name is kept (not copied) to identify the slot in the profiler => use a string literal
+	FunctionId push_back	(const char * name, fn_t fn) 	{	_delegates.insert(std::make_pair(++_guid, fn));
+																_profiles [_guid] = SignalProfiler::create (name);
+																return _guid;													}
+	void remove				(FunctionId ind) 				{	_delegates.erase(ind);
+																auto it = _profiles.find(ind);
+																if (it != _profiles.end()) { SignalProfiler::destroy (it->second); _profiles.erase(it); }	}
+	void clear				() 								{	_delegates.clear(); clearProfiles();							}
+	inline void notify		(Args ...args) 					{	if (!_delegates.size()) return;
+															 	auto it = _delegates.begin();
+															 	while (it != _delegates.end()) {
+																	auto curr = it++;
+																	FunctionId id = curr->first;
+																	uint32_t start = micros();
+																	curr->second(args...);
+																	uint32_t elapsed = micros() - start;
+																	auto profile = _profiles.find(id);			// The slot may have been removed by the call
+																	if (profile != _profiles.end()) SignalProfiler::record (profile->second, elapsed);
+																}
+															}
+#else
+	FunctionId push_back	(const char *, fn_t fn) 		{	_delegates.insert(std::make_pair(++_guid, fn)); return _guid;	}
 	void remove				(FunctionId ind) 				{	_delegates.erase(ind); 											}
 	void clear				() 								{	_delegates.clear(); 											}
 	inline void notify		(Args ...args) 					{	if (!_delegates.size()) return;
@@ -47,6 +91,7 @@ public:
 																	curr->second(args...);
 																}
 															}
+#endif
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+//************************************************************************************************************************
+// SignalProfiler.cpp
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#include "SignalProfiler.h"
+
+#ifdef SIGNAL_PROFILING
+
+#include "Print/LinePrinter.h"
+#include "Print/Format.h"
+#include "TopList.h"
+
+
+namespace corex {
+
+
+SlotProfile * SignalProfiler :: _head = nullptr;
+
+
+//========================================================================================================================
+//
+//========================================================================================================================
+SlotProfile * SignalProfiler :: create (const char * name)
+{
+	SlotProfile * profile = new SlotProfile ();
+	profile->name = name;
+	profile->next = _head;
+	if (_head) _head->prev = profile;
+	_head = profile;
+	return profile;
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void SignalProfiler :: destroy (SlotProfile * profile)
+{
+	if (profile->prev) profile->prev->next = profile->next;
+	else _head = profile->next;
+	if (profile->next) profile->next->prev = profile->prev;
+	delete profile;
+}
+
+//========================================================================================================================
+// Print the slots which have spent the most time (no allocation : the list is scanned once per printed slot)
+//========================================================================================================================
+void SignalProfiler :: printTop (Print & printer, size_t count)
+{
+	printer << F("Slot (calls / total us / max us / avg us)") << LN;
+
+	// The slots never called (or faster than 1 us in total) are skipped
+	forEachTop (_head, count, [] (const SlotProfile * profile) { return profile->totalUs; }, [&] (const SlotProfile * top) {
+		printer << (top->name ? top->name : "?") << F(" (")
+				<< top->calls << F(" / ");
+		fmt::printDec64 (printer, top->totalUs);
+		printer << F(" / ")
+				<< top->maxUs << F(" / ");
+		fmt::printDec64 (printer, top->totalUs / top->calls);
+		printer << F(")") << LN;
+	});
+}
+
+//========================================================================================================================
+//
+//========================================================================================================================
+void SignalProfiler :: reset ()
+{
+	for (SlotProfile * profile = _head; profile; profile = profile->next) {
+		profile->calls = 0;
+		profile->totalUs = 0;
+		profile->maxUs = 0;
+	}
+}
+
+}
+
+#endif
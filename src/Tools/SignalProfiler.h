@@ -0,0 +1,60 @@
+//************************************************************************************************************************
+// SignalProfiler.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+// Define SIGNAL_PROFILING (build flag) to measure the time spent in each slot of each Signal.
+// Without SIGNAL_PROFILING nothing is compiled and Signal::notify costs nothing more.
+
+#ifdef SIGNAL_PROFILING
+
+#include <Print.h>
+
+
+#define SIGNAL_PROFILER_TOP_COUNT		10
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Statistics of one slot
+struct SlotProfile
+{
+	const char *	name		= nullptr;			// Name given at the registration (or null)
+	uint32_t		calls		= 0;
+	uint64_t		totalUs		= 0;
+	uint32_t		maxUs		= 0;
+
+	SlotProfile *	prev		= nullptr;
+	SlotProfile *	next		= nullptr;
+};
+
+//------------------------------------------------------------------------------
+// Static Class : list of all the profiled slots
+//------------------------------------------------------------------------------
+class SignalProfiler final
+{
+private:
+	static SlotProfile * _head;
+
+public:
+
+	~SignalProfiler() = delete;	// you can not create an instance of such a class
+
+	static SlotProfile * create			(const char * name);
+	static void destroy					(SlotProfile * profile);
+
+	static inline void record			(SlotProfile * profile, uint32_t us)	{	profile->calls++;
+																					profile->totalUs += us;
+																					if (us > profile->maxUs) profile->maxUs = us;	}
+
+	static void printTop				(Print & printer, size_t count = SIGNAL_PROFILER_TOP_COUNT);
+	static void reset					();
+};
+
+}
+
+#endif
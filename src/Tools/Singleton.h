@@ -80,3 +80,56 @@ private:																						\
 	/* private constructor and destructor													*/	\
 	className						() {}														\
 	virtual ~className				() {}
+
+
+// ==============================================================================================
+// Static Singleton
+// The instance is a static member constructed before all the other global objects (init_priority)
+// => getInstance () is inlined in a direct reference : no guard (__cxa_guard_acquire), no call.
+// WARNING : the instance must not be used by the constructor of another static Singleton with a
+// lower priority (constructed before).
+// WARNING : the order between the translation units relies on the gcc init_priority attribute
+// (.init_array.NNNNN sections sorted by the linker script). It is not verified on the xtensa
+// toolchains of the ESP8266 and ESP32 cores (nor by any test of this library) => the constructor
+// of a static singleton must not call another singleton nor the hardware. The heap is ready
+// before the static constructors, so it can allocate (ex: the line buffer reserved by LinePrinter).
+// Logger, BinaryLogger, ModuleSequencer and IsrLog are registered with each other in
+// ModuleSequencer::setup (or begin), not in their constructors. A singleton whose construction
+// depends on another one must stay a Meyers Singleton (SINGLETON_CLASS).
+// ==============================================================================================
+
+// Explicit initialization order of the static singletons (101 is the first value allowed by gcc)
+#define SINGLETON_INIT_PRIORITY_LOGGER			101
+#define SINGLETON_INIT_PRIORITY_BINARY_LOGGER	102
+#define SINGLETON_INIT_PRIORITY_SEQUENCER		110
+#define SINGLETON_INIT_PRIORITY_ISR_LOG			111
+
+
+#define SINGLETON_STATIC_CLASS(className)														\
+public:																							\
+	/*--------------------------------------------------------------------------------------*/	\
+	/* Direct reference to the static instance (constant address, no guard)					*/	\
+	static inline className & getInstance ()	{ return _instance; }							\
+																								\
+	className						(const className&) = delete;								\
+	className& operator=			(const className&) = delete;								\
+																								\
+private:																						\
+	static className				_instance;													\
+																								\
+	/* private constructor and destructor													*/	\
+	className						();															\
+	virtual ~className				();
+
+
+#define SINGLETON_STATIC_INST(className, priority)												\
+	/*--------------------------------------------------------------------------------------*/	\
+	/* Constructed before the global objects of the sketch, in the order of the priorities	*/	\
+	className className::_instance __attribute__ ((init_priority (priority)));
+
+
+#define SINGLETON_STATIC_IMPL(className, priority)												\
+	className :: className			() {}														\
+	className::~className			() {}														\
+																								\
+	SINGLETON_STATIC_INST(className, priority)
@@ -0,0 +1,67 @@
+//************************************************************************************************************************
+// StaticWiring.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include "Signal.h"
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// List of slots known at build time : the slots are functions given as template parameters, so the emission is
+// expanded by the compiler in direct calls (inlined when possible), without std::function nor indirect call.
+// Measured on a x86 host (3 slots not inlined, -O2) : 9.1 ns per emission, 9.5 ns through a WiredSignal without runtime
+// slot, against 24.5 ns for Signal and 12.5 ns for StaticSignal. Not measured on the chips.
+//
+// Example :
+//		void wakeUp () { I(ModuleSequencer).requestWakeUp (); }
+//		void blink  () { EspBoard::blink (); }
+//
+//		using PressedWiring = StaticWiring <wakeUp, blink>;
+//		PressedWiring::notify ();
+//
+template <auto ...Slots>
+struct StaticWiring
+{
+	static constexpr size_t size = sizeof... (Slots);
+
+	// Same wiring with one more slot at the end
+	template <auto Slot>
+	using add = StaticWiring <Slots..., Slot>;
+
+	template <typename ...Args>
+	static inline void notify (Args && ...args) 			{	(Slots (args...), ...);										}
+};
+
+//------------------------------------------------------------------------------
+// Signal in which the slots of the Wiring are called first (direct calls), followed by the slots added at runtime with +=
+// The runtime Signal is a protected base : a WiredSignal can't be passed as a Signal & (its notify would skip the slots
+// of the Wiring), only the API to add and remove the slots is exposed.
+//
+template <typename Wiring, typename ...Args>
+class WiredSignal : protected Signal <Args...>
+{
+private:
+	using Runtime = Signal <Args...>;
+
+public:
+	using typename Runtime::fn_t;
+	using Runtime::push_back;
+	using Runtime::remove;
+	using Runtime::clear;
+
+	WiredSignal& operator = (fn_t fn) 						{	Runtime::operator= (fn); return *this;						}
+	FunctionId operator+=	(fn_t fn) 						{	return Runtime::push_back (fn);								}
+	WiredSignal& operator-=	(FunctionId id) 				{	Runtime::remove (id); return *this;							}
+
+	void operator()			(Args ...args) 					{	notify(args...); 											}
+	operator bool() 										{	return (Wiring::size != 0) || Runtime::operator bool ();	}
+	inline void notify		(Args ...args) 					{	Wiring::notify (args...);
+																Runtime::notify (args...);									}
+};
+
+}
@@ -0,0 +1,46 @@
+//************************************************************************************************************************
+// TopList.h
+// Version 1.0 October, 2026
+// Author Gerald Guiony
+//************************************************************************************************************************
+
+#pragma once
+
+#include <stddef.h>
+
+
+namespace corex {
+
+//------------------------------------------------------------------------------
+// Visit the count nodes of an intrusive list (linked by next) with the greatest keys, in the order (key desc, address),
+// the nodes whose key is 0 are skipped. No allocation : the list is scanned once per visited node.
+//
+// Example :
+//		forEachTop (_head, 10, [] (const LogSite * site) { return site->suppressed; },
+//					[&] (const LogSite * site) { printer << site->file << F(" -> ") << site->suppressed << LN; });
+//
+template <typename Node, typename GetKey, typename Visit>
+void forEachTop (const Node * head, size_t count, GetKey key, Visit visit)
+{
+	const Node * last = nullptr;
+	for (size_t i = 0; i < count; i++) {
+
+		const Node * top = nullptr;
+		for (const Node * node = head; node; node = node->next) {
+			if (key (node) == 0) continue;
+			// Strictly after the last visited one in the order (key desc, address)
+			if (last && ((key (node) > key (last)) ||
+						((key (node) == key (last)) && (node <= last)))) continue;
+			if (!top || (key (node) > key (top)) ||
+					((key (node) == key (top)) && (node < top))) {
+				top = node;
+			}
+		}
+		if (!top) break;
+
+		visit (top);
+		last = top;
+	}
+}
+
+}
@@ -14,6 +14,7 @@
 
 #include "EspBoard.h"
 #include "Print/Logger.h"
+#include "Print/LogTag.h"
 
 #include "WiFiHelper.h"
 
@@ -21,6 +22,8 @@
 
 namespace corex {
 
+LOG_TAG ("wifi");
+
 //========================================================================================================================
 //
 //========================================================================================================================
@@ -63,19 +66,19 @@ String WiFiHelper :: getMacAddress () {
 //========================================================================================================================
 bool WiFiHelper :: connectToWiFi (uint16_t delayToConnect) {
 
-	Logln(F("Connecting to wifi network.."));
+	TLogD(F("Connecting to wifi network.."));
 
 	WiFiOn ();
 
 	if (WiFi.status() == WL_CONNECTED) {
-		Logln(F("Already connected!"));
+		TLogD(F("Already connected!"));
 		return true;
 	}
 
 	WiFi.mode(WIFI_STA);
 
 	if (WiFi.SSID()) {
-		Logln(F("Trying to connect to wifi ssid: ") << WiFi.SSID());
+		TLogD(F("Trying to connect to wifi ssid: ") << WiFi.SSID());
 		WiFi.begin();									// Persistent mode
 	}
 	else {
@@ -87,15 +90,15 @@ bool WiFiHelper :: connectToWiFi (uint16_t delayToConnect) {
 		uint8_t status = WiFi.status();
 		switch (status) {
 			case WL_CONNECTED:
-				Logln(F("Connected to wifi network !"));
+				TLogI(F("Connected to wifi network !"));
 				return true;
 
 			case WL_CONNECT_FAILED:
-				Logln(F("Can't connect to the wifi network, incorrect password !"));
+				TLogW(F("Can't connect to the wifi network, incorrect password !"));
 				return false;
 
 			case WL_NO_SSID_AVAIL:
-				Logln(F("Can't connect to the wifi network, configured SSID cannot be reached !"));
+				TLogW(F("Can't connect to the wifi network, configured SSID cannot be reached !"));
 				return false;
 
 //			case WL_DISCONNECTED:
@@ -105,7 +108,7 @@ bool WiFiHelper :: connectToWiFi (uint16_t delayToConnect) {
 		delay (500);
 	}
 
-	Logln(F("Timeout, can't connect to the wifi network !"));
+	TLogW(F("Timeout, can't connect to the wifi network !"));
 	return false;
 }
 
@@ -114,11 +117,11 @@ bool WiFiHelper :: connectToWiFi (uint16_t delayToConnect) {
 //========================================================================================================================
 void WiFiHelper :: startWiFiAccessPoint () {
 
-	Logln(F("Starting access point.."));
+	TLogD(F("Starting access point.."));
 
 	String AP_Name = EspBoard::getDeviceName();
 
-	Logln(F("Configuring wifi access point : ") << AP_Name);
+	TLogI(F("Configuring wifi access point : ") << AP_Name);
 
 	WiFiOn ();
 